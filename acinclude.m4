@@ -6,6 +6,10 @@ dnl Function to detect if libfsxfs dependencies are available
 AC_DEFUN([AX_LIBFSXFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsxfs/libfsxfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping functions in libfsxfs/libfsxfs_memory_map.c
+  AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
 ])
 
 dnl Function to check if DLL support is needed
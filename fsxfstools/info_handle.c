@@ -2349,47 +2349,100 @@ int info_handle_file_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error )
 {
-	static char *function           = "info_handle_file_entries_fprint";
-	uint64_t file_entry_identifier  = 0;
-	uint32_t number_of_file_entries = 0;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	static char *function                   = "info_handle_file_entries_fprint";
+	uint64_t file_entry_identifier          = 0;
+	int result                              = 0;
 
-#ifdef TODO
-	if( libfsxfs_volume_get_number_of_file_entries(
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inode scanner returns the used inodes in on-disk order
+	 */
+	if( libfsxfs_volume_open_inode_scanner(
 	     info_handle->input_volume,
-	     &number_of_file_entries,
+	     &inode_scanner,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of file entries.",
+		 LIBCERROR_RUNTIME_ERROR_OPEN_FAILED,
+		 "%s: unable to open inode scanner.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	for( file_entry_identifier = 0;
-	     file_entry_identifier < (uint64_t) number_of_file_entries;
-	     file_entry_identifier++ )
+	do
 	{
-		if( info_handle_file_entry_fprint_by_identifier(
-		     info_handle,
-		     file_entry_identifier,
-		     error ) != 1 )
+		result = libfsxfs_inode_scanner_get_next_inode(
+		          inode_scanner,
+		          &file_entry_identifier,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print file entry: %" PRIu64 " information.",
-			 function,
-			 file_entry_identifier );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next inode.",
+			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( info_handle_file_entry_fprint_by_identifier(
+			     info_handle,
+			     file_entry_identifier,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print file entry: %" PRIu64 " information.",
+				 function,
+				 file_entry_identifier );
+
+				goto on_error;
+			}
 		}
 	}
+	while( result != 0 );
+
+	if( libfsxfs_inode_scanner_close(
+	     &inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close inode scanner.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Prints the file entry information for a specific identifier
@@ -119,6 +119,77 @@ struct fsxfs_directory_leaf_block_entry_v1
 	uint8_t unknown1;
 };
 
+typedef struct fsxfs_directory_branch_block_header_v3 fsxfs_directory_branch_block_header_v3_t;
+
+struct fsxfs_directory_branch_block_header_v3
+{
+	/* Number of entries
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_entries[ 2 ];
+
+	/* Node level size
+	 * Consists of 2 bytes
+	 */
+	uint8_t node_level[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+};
+
+typedef struct fsxfs_directory_hash_block_header_v2 fsxfs_directory_hash_block_header_v2_t;
+
+struct fsxfs_directory_hash_block_header_v2
+{
+	/* Number of entries
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_entries[ 2 ];
+
+	/* Number of stale entries
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_stale_entries[ 2 ];
+};
+
+typedef struct fsxfs_directory_hash_block_header_v3 fsxfs_directory_hash_block_header_v3_t;
+
+struct fsxfs_directory_hash_block_header_v3
+{
+	/* Number of entries
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_entries[ 2 ];
+
+	/* Number of stale entries
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_stale_entries[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+};
+
+typedef struct fsxfs_directory_hash_block_entry_v2 fsxfs_directory_hash_block_entry_v2_t;
+
+struct fsxfs_directory_hash_block_entry_v2
+{
+	/* Name hash
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_hash[ 4 ];
+
+	/* Data address
+	 * Consists of 4 bytes
+	 * Contains the offset of the directory entry in units of 8 bytes
+	 */
+	uint8_t data_address[ 4 ];
+};
+
 #if defined( __cplusplus )
 }
 #endif
@@ -146,6 +146,155 @@ int libfsxfs_attribute_values_free(
 	return( 1 );
 }
 
+/* Clones attribute values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_attribute_values_clone(
+     libfsxfs_attribute_values_t **destination_attribute_values,
+     libfsxfs_attribute_values_t *source_attribute_values,
+     libcerror_error_t **error )
+{
+	libfsxfs_attribute_values_t *safe_attribute_values = NULL;
+	static char *function                              = "libfsxfs_attribute_values_clone";
+
+	if( destination_attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_attribute_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination attribute values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_attribute_values == NULL )
+	{
+		*destination_attribute_values = NULL;
+
+		return( 1 );
+	}
+	safe_attribute_values = memory_allocate_structure(
+	                         libfsxfs_attribute_values_t );
+
+	if( safe_attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     safe_attribute_values,
+	     source_attribute_values,
+	     sizeof( libfsxfs_attribute_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination attribute values.",
+		 function );
+
+		memory_free(
+		 safe_attribute_values );
+
+		return( -1 );
+	}
+	safe_attribute_values->name       = NULL;
+	safe_attribute_values->value_data = NULL;
+
+	if( source_attribute_values->name != NULL )
+	{
+		safe_attribute_values->name = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * source_attribute_values->name_size );
+
+		if( safe_attribute_values->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination name.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_attribute_values->name,
+		     source_attribute_values->name,
+		     source_attribute_values->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( source_attribute_values->value_data != NULL )
+	{
+		safe_attribute_values->value_data = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * source_attribute_values->value_data_size );
+
+		if( safe_attribute_values->value_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_attribute_values->value_data,
+		     source_attribute_values->value_data,
+		     (size_t) source_attribute_values->value_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination value data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*destination_attribute_values = safe_attribute_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &safe_attribute_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Sets the name including prefix
  * Returns 1 if successful or -1 on error
  */
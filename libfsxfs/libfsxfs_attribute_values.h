@@ -47,11 +47,21 @@ struct libfsxfs_attribute_values
 	 */
 	uint32_t value_data_size;
 
-	/* Value data
+	/* Value data, only set if the value data location is the value data
 	 */
 	uint8_t *value_data;
 
-	/* Value data block number
+	/* Value data location
+	 */
+	uint8_t value_data_location;
+
+	/* Value data offset, relative to the start of the inline attributes data
+	 * or the attributes leaf block
+	 */
+	size_t value_data_offset;
+
+	/* Value data block number, of the attributes leaf block that contains
+	 * the value data or of the first remote value data block
 	 */
 	uint32_t value_data_block_number;
 };
@@ -64,6 +74,11 @@ int libfsxfs_attribute_values_free(
      libfsxfs_attribute_values_t **attribute_values,
      libcerror_error_t **error );
 
+int libfsxfs_attribute_values_clone(
+     libfsxfs_attribute_values_t **destination_attribute_values,
+     libfsxfs_attribute_values_t *source_attribute_values,
+     libcerror_error_t **error );
+
 int libfsxfs_attribute_values_set_name(
      libfsxfs_attribute_values_t *attribute_values,
      const uint8_t *name,
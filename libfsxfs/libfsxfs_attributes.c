@@ -20,6 +20,8 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include "libfsxfs_attribute_values.h"
@@ -39,6 +41,8 @@
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libfdata.h"
+#include "libfsxfs_libuna.h"
+#include "libfsxfs_name_hash.h"
 
 #include "fsxfs_attributes_block.h"
 #include "fsxfs_file_system_block.h"
@@ -255,10 +259,12 @@ int libfsxfs_attributes_read_branch_values(
 }
 
 /* Reads the attributes leaf values
+ * The value data is not copied, only its location in the leaf block or remote value blocks is stored
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_attributes_read_leaf_values(
      libfsxfs_io_handle_t *io_handle,
+     uint32_t block_number,
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *extended_attributes_array,
@@ -632,24 +638,13 @@ int libfsxfs_attributes_read_leaf_values(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			if( attribute_values->value_data_size > 0 )
-			{
-				if( libfsxfs_attribute_values_set_value_data(
-				     attribute_values,
-				     &( data[ values_offset ] ),
-				     (size_t) attribute_values->value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set value data.",
-					 function );
-
-					goto on_error;
-				}
-			}
+			attribute_values->value_data_location     = LIBFSXFS_VALUE_DATA_LOCATION_LEAF_BLOCK;
+			attribute_values->value_data_offset       = (size_t) values_offset;
+			attribute_values->value_data_block_number = block_number;
+		}
+		else
+		{
+			attribute_values->value_data_location = LIBFSXFS_VALUE_DATA_LOCATION_REMOTE_BLOCKS;
 		}
 		if( ( flags & 0x08 ) != 0 )
 		{
@@ -724,26 +719,24 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the extended attributes from an attributes block
+/* Reads an attributes block
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_attributes_read_from_block(
+int libfsxfs_attributes_read_block(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libfsxfs_inode_t *inode,
      uint32_t block_number,
-     libcdata_array_t *extended_attributes_array,
-     int recursion_depth,
+     libfsxfs_file_system_block_t **file_system_block,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_t *extent                       = NULL;
-	libfsxfs_file_system_block_t *file_system_block = NULL;
-	static char *function                           = "libfsxfs_attributes_read_from_block";
-	off64_t block_offset                            = 0;
-	uint64_t relative_block_number                  = 0;
-	int allocation_group_index                      = 0;
-	int extent_index                                = 0;
-	int number_of_extents                           = 0;
+	libfsxfs_extent_t *extent      = NULL;
+	static char *function          = "libfsxfs_attributes_read_block";
+	off64_t block_offset           = 0;
+	uint64_t relative_block_number = 0;
+	int allocation_group_index     = 0;
+	int extent_index               = 0;
+	int result                     = 0;
 
 	if( io_handle == NULL )
 	{
@@ -756,73 +749,48 @@ int libfsxfs_attributes_read_from_block(
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	if( file_system_block == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system block.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_get_number_of_attributes_extents(
-	     inode,
-	     &number_of_extents,
-	     error ) != 1 )
+	if( *file_system_block != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of attributes extents.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system block value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO optimize this lookup */
-
-	for( extent_index = 0;
-	     extent_index < number_of_extents;
-	     extent_index++ )
+	result = libfsxfs_inode_get_attributes_extent_by_logical_block_number(
+	          inode,
+	          (uint64_t) block_number,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
 	{
-		if( libfsxfs_inode_get_attributes_extent_by_index(
-		     inode,
-		     extent_index,
-		     &extent,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve attributes extent: %d.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
-		if( extent == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing extent: %d.",
-			 function,
-			 extent_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attributes extent for block number: %" PRIu32 ".",
+		 function,
+		 block_number );
 
-			goto on_error;
-		}
-		if( ( block_number >= extent->logical_block_number )
-		 && ( block_number < ( extent->logical_block_number + extent->number_of_blocks ) ) )
-		{
-			break;
-		}
+		goto on_error;
 	}
-	if( extent_index >= number_of_extents )
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -868,7 +836,7 @@ int libfsxfs_attributes_read_from_block(
 	block_offset *= io_handle->block_size;
 
 	if( libfsxfs_file_system_block_initialize(
-	     &file_system_block,
+	     file_system_block,
 	     io_handle->block_size,
 	     error ) != 1 )
 	{
@@ -882,7 +850,7 @@ int libfsxfs_attributes_read_from_block(
 		goto on_error;
 	}
 	if( libfsxfs_file_system_block_read_file_io_handle(
-	     file_system_block,
+	     *file_system_block,
 	     io_handle,
 	     file_io_handle,
 	     block_offset,
@@ -899,11 +867,80 @@ int libfsxfs_attributes_read_from_block(
 
 		goto on_error;
 	}
+	return( 1 );
+
+on_error:
+	if( *file_system_block != NULL )
+	{
+		libfsxfs_file_system_block_free(
+		 file_system_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the extended attributes from an attributes block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_attributes_read_from_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t block_number,
+     libcdata_array_t *extended_attributes_array,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_system_block_t *file_system_block = NULL;
+	static char *function                           = "libfsxfs_attributes_read_from_block";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_attributes_read_block(
+	     io_handle,
+	     file_io_handle,
+	     inode,
+	     block_number,
+	     &file_system_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read attributes block: %" PRIu32 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
 	if( ( file_system_block->header->signature == 0x3bee )
 	 || ( file_system_block->header->signature == 0xfbee ) )
 	{
 		if( libfsxfs_attributes_read_leaf_values(
 		     io_handle,
+		     block_number,
 		     file_system_block->data,
 		     file_system_block->data_size,
 		     extended_attributes_array,
@@ -1123,36 +1160,42 @@ on_error:
 	return( -1 );
 }
 
-/* Creates a data stream of the attribute value data
- * Make sure the value data_stream is referencing, is set to NULL
+/* Retrieves the attribute values of an attributes leaf block entry
+ * The values offset must point to the values of the entry
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_attributes_get_value_data_stream(
-     libfsxfs_io_handle_t *io_handle,
-     libfsxfs_inode_t *inode,
-     libfsxfs_attribute_values_t *attribute_values,
-     libfdata_stream_t **data_stream,
+int libfsxfs_attributes_get_leaf_entry_values(
+     uint32_t block_number,
+     const uint8_t *data,
+     size_t data_size,
+     size_t values_offset,
+     uint8_t flags,
+     libfsxfs_attribute_values_t **attribute_values,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	libfsxfs_extent_t *extent           = NULL;
-	static char *function               = "libfsxfs_attributes_get_value_data_stream";
-	size64_t data_segment_size          = 0;
-	off64_t data_segment_offset         = 0;
-	uint64_t relative_block_number      = 0;
-	uint32_t remaining_value_data_size  = 0;
-	int allocation_group_index          = 0;
-	int extent_index                    = 0;
-	int number_of_extents               = 0;
-	int segment_index                   = 0;
+	libfsxfs_attribute_values_t *safe_attribute_values = NULL;
+	static char *function                              = "libfsxfs_attributes_get_leaf_entry_values";
+	size_t values_data_size                            = 0;
+	uint8_t name_size                                  = 0;
 
-	if( io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -1168,113 +1211,1126 @@ int libfsxfs_attributes_get_value_data_stream(
 
 		return( -1 );
 	}
-	if( data_stream == NULL )
+	if( ( flags & 0x01 ) != 0 )
+	{
+		values_data_size = sizeof( fsxfs_attributes_block_values_local_t );
+	}
+	else
+	{
+		values_data_size = sizeof( fsxfs_attributes_block_values_remote_t );
+	}
+	if( ( values_offset >= data_size )
+	 || ( values_data_size > ( data_size - values_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data stream.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid values offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( attribute_values->value_data_block_number == 0 )
+	if( libfsxfs_attribute_values_initialize(
+	     &safe_attribute_values,
+	     error ) != 1 )
 	{
-		if( libfsxfs_data_stream_initialize_from_data(
-		     data_stream,
-		     attribute_values->value_data,
-		     (size_t) attribute_values->value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data stream.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create attribute values.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
+	}
+	if( ( flags & 0x01 ) != 0 )
+	{
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_attributes_block_values_local_t *) &( data[ values_offset ] ) )->value_data_size,
+		 safe_attribute_values->value_data_size );
+
+		name_size = ( (fsxfs_attributes_block_values_local_t *) &( data[ values_offset ] ) )->name_size;
 	}
 	else
 	{
-		if( libfsxfs_inode_get_number_of_attributes_extents(
-		     inode,
-		     &number_of_extents,
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_attributes_block_values_remote_t *) &( data[ values_offset ] ) )->value_data_block_number,
+		 safe_attribute_values->value_data_block_number );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_attributes_block_values_remote_t *) &( data[ values_offset ] ) )->value_data_size,
+		 safe_attribute_values->value_data_size );
+
+		name_size = ( (fsxfs_attributes_block_values_remote_t *) &( data[ values_offset ] ) )->name_size;
+	}
+	values_offset += values_data_size;
+
+	if( name_size > ( data_size - values_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( name_size > 0 )
+	{
+		if( libfsxfs_attribute_values_set_name(
+		     safe_attribute_values,
+		     &( data[ values_offset ] ),
+		     (size_t) name_size,
+		     flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of attributes extents.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set name.",
 			 function );
 
 			goto on_error;
 		}
-		for( extent_index = 0;
-		     extent_index < number_of_extents;
-		     extent_index++ )
-		{
-			if( libfsxfs_inode_get_attributes_extent_by_index(
-			     inode,
-			     extent_index,
-			     &extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve attributes extent: %d.",
-				 function,
-				 extent_index );
-
-				goto on_error;
-			}
-			if( extent == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing extent: %d.",
-				 function,
-				 extent_index );
-
-				goto on_error;
-			}
-			if( ( attribute_values->value_data_block_number >= extent->logical_block_number )
-			 && ( attribute_values->value_data_block_number < ( extent->logical_block_number + extent->number_of_blocks ) ) )
-			{
-				break;
-			}
-		}
-		if( extent_index >= number_of_extents )
+		values_offset += name_size;
+	}
+	if( ( flags & 0x01 ) != 0 )
+	{
+		if( safe_attribute_values->value_data_size > ( data_size - values_offset ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid block number: %" PRIu32 " value out of bounds.",
-			 function,
-			 attribute_values->value_data_block_number );
+			 "%s: invalid value data size value out of bounds.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-/* TODO add v5 remote value data block header support */
-		if( io_handle->format_version == 5 )
-		{
-			libcerror_error_set(
-			 error,
+		safe_attribute_values->value_data_location     = LIBFSXFS_VALUE_DATA_LOCATION_LEAF_BLOCK;
+		safe_attribute_values->value_data_offset       = values_offset;
+		safe_attribute_values->value_data_block_number = block_number;
+	}
+	else
+	{
+		safe_attribute_values->value_data_location = LIBFSXFS_VALUE_DATA_LOCATION_REMOTE_BLOCKS;
+	}
+	*attribute_values = safe_attribute_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &safe_attribute_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the attribute values for a specific name from the attributes (leaf and node) blocks
+ * The name is an UTF-8 encoded byte stream without the namespace prefix and end of string character
+ * The namespace flags contain the namespace of the name as stored in the leaf block entry flags
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t namespace_flags,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_system_block_t *file_system_block = NULL;
+	fsxfs_attributes_leaf_block_entry_t *leaf_entry = NULL;
+	static char *function                           = "libfsxfs_attributes_get_attribute_values_from_blocks_by_name";
+	size_t data_offset                              = 0;
+	size_t entries_data_size                        = 0;
+	size_t header_data_size                         = 0;
+	size_t values_data_size                         = 0;
+	uint32_t block_number                           = 0;
+	uint32_t entry_name_hash                        = 0;
+	uint32_t name_hash                              = 0;
+	uint16_t number_of_entries                      = 0;
+	uint16_t values_offset                          = 0;
+	uint8_t entry_name_size                         = 0;
+	uint8_t flags                                   = 0;
+	int entry_index                                 = 0;
+	int entry_lower_index                           = 0;
+	int entry_middle_index                          = 0;
+	int entry_upper_index                           = 0;
+	int read_next_block                             = 0;
+	int recursion_depth                             = 0;
+	int result                                      = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Names longer than 255 bytes cannot be stored in a leaf block entry
+	 */
+	if( ( name_size == 0 )
+	 || ( name_size > 255 ) )
+	{
+		return( 0 );
+	}
+	if( libfsxfs_name_hash_calculate(
+	     &name_hash,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		header_data_size = sizeof( fsxfs_file_system_block_header_v3_t );
+	}
+	else
+	{
+		header_data_size = sizeof( fsxfs_file_system_block_header_v1_t );
+	}
+	/* Descend the node blocks to the leaf block that contains the name hash
+	 */
+	for( recursion_depth = 0;
+	     recursion_depth <= LIBFSXFS_MAXIMUM_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( libfsxfs_attributes_read_block(
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     block_number,
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attributes block: %" PRIu32 ".",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		if( ( file_system_block->header->signature == 0x3bee )
+		 || ( file_system_block->header->signature == 0xfbee ) )
+		{
+			break;
+		}
+		if( ( file_system_block->header->signature != 0x3ebe )
+		 && ( file_system_block->header->signature != 0xfebe ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature: 0x%04" PRIx16 ".",
+			 function,
+			 file_system_block->header->signature );
+
+			goto on_error;
+		}
+		data_offset = header_data_size;
+
+		if( io_handle->format_version == 5 )
+		{
+			entries_data_size = sizeof( fsxfs_attributes_branch_block_header_v3_t );
+		}
+		else
+		{
+			entries_data_size = sizeof( fsxfs_attributes_branch_block_header_v2_t );
+		}
+		if( ( data_offset >= file_system_block->data_size )
+		 || ( entries_data_size > ( file_system_block->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file system block - data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_attributes_branch_block_header_v2_t *) &( file_system_block->data[ data_offset ] ) )->number_of_entries,
+		 number_of_entries );
+
+		data_offset += entries_data_size;
+
+		entries_data_size = sizeof( fsxfs_attributes_branch_block_entry_t ) * number_of_entries;
+
+		if( ( number_of_entries == 0 )
+		 || ( entries_data_size > ( file_system_block->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The node entry that covers the name hash is the first entry with a name hash
+		 * equal to or greater than the name hash or the last entry otherwise
+		 */
+		entry_lower_index = 0;
+		entry_upper_index = (int) number_of_entries - 1;
+
+		while( entry_lower_index < entry_upper_index )
+		{
+			entry_middle_index = entry_lower_index + ( ( entry_upper_index - entry_lower_index ) / 2 );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_attributes_branch_block_entry_t *) &( file_system_block->data[ data_offset + ( entry_middle_index * sizeof( fsxfs_attributes_branch_block_entry_t ) ) ] ) )->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash < name_hash )
+			{
+				entry_lower_index = entry_middle_index + 1;
+			}
+			else
+			{
+				entry_upper_index = entry_middle_index;
+			}
+		}
+		data_offset += entry_lower_index * sizeof( fsxfs_attributes_branch_block_entry_t );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_attributes_branch_block_entry_t *) &( file_system_block->data[ data_offset ] ) )->sub_block_number,
+		 block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: name hash: 0x%08" PRIx32 " in node entry: %d with sub block number: %" PRIu32 "\n",
+			 function,
+			 name_hash,
+			 entry_lower_index,
+			 block_number );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( libfsxfs_file_system_block_free(
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_system_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Scan the leaf block entries with a matching name hash, entries with the same
+	 * name hash can continue in the next leaf block
+	 */
+	while( file_system_block != NULL )
+	{
+		if( ( file_system_block->header->signature != 0x3bee )
+		 && ( file_system_block->header->signature != 0xfbee ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature: 0x%04" PRIx16 ".",
+			 function,
+			 file_system_block->header->signature );
+
+			goto on_error;
+		}
+		data_offset = header_data_size;
+
+		if( io_handle->format_version == 5 )
+		{
+			entries_data_size = sizeof( fsxfs_attributes_leaf_block_header_v3_t );
+		}
+		else
+		{
+			entries_data_size = sizeof( fsxfs_attributes_leaf_block_header_v2_t );
+		}
+		if( ( data_offset >= file_system_block->data_size )
+		 || ( entries_data_size > ( file_system_block->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file system block - data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_attributes_leaf_block_header_v2_t *) &( file_system_block->data[ data_offset ] ) )->number_of_entries,
+		 number_of_entries );
+
+		data_offset += entries_data_size;
+
+		entries_data_size = sizeof( fsxfs_attributes_leaf_block_entry_t ) * number_of_entries;
+
+		if( entries_data_size > ( file_system_block->data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the first entry with a name hash equal to or greater than the name hash
+		 */
+		entry_lower_index = 0;
+		entry_upper_index = (int) number_of_entries;
+
+		while( entry_lower_index < entry_upper_index )
+		{
+			entry_middle_index = entry_lower_index + ( ( entry_upper_index - entry_lower_index ) / 2 );
+
+			leaf_entry = (fsxfs_attributes_leaf_block_entry_t *) &( file_system_block->data[ data_offset + ( entry_middle_index * sizeof( fsxfs_attributes_leaf_block_entry_t ) ) ] );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 leaf_entry->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash < name_hash )
+			{
+				entry_lower_index = entry_middle_index + 1;
+			}
+			else
+			{
+				entry_upper_index = entry_middle_index;
+			}
+		}
+		read_next_block = 0;
+
+		for( entry_index = entry_lower_index;
+		     entry_index < (int) number_of_entries;
+		     entry_index++ )
+		{
+			leaf_entry = (fsxfs_attributes_leaf_block_entry_t *) &( file_system_block->data[ data_offset + ( entry_index * sizeof( fsxfs_attributes_leaf_block_entry_t ) ) ] );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 leaf_entry->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash != name_hash )
+			{
+				break;
+			}
+			flags = leaf_entry->flags;
+
+			if( ( ( flags & 0x08 ) != 0 )
+			 || ( ( flags & 0x7e ) != namespace_flags ) )
+			{
+				continue;
+			}
+			byte_stream_copy_to_uint16_big_endian(
+			 leaf_entry->values_offset,
+			 values_offset );
+
+			if( ( flags & 0x01 ) != 0 )
+			{
+				values_data_size = sizeof( fsxfs_attributes_block_values_local_t );
+			}
+			else
+			{
+				values_data_size = sizeof( fsxfs_attributes_block_values_remote_t );
+			}
+			if( ( (size_t) values_offset < ( data_offset + entries_data_size ) )
+			 || ( (size_t) values_offset >= file_system_block->data_size )
+			 || ( values_data_size > ( file_system_block->data_size - values_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid values offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( flags & 0x01 ) != 0 )
+			{
+				entry_name_size = ( (fsxfs_attributes_block_values_local_t *) &( file_system_block->data[ values_offset ] ) )->name_size;
+			}
+			else
+			{
+				entry_name_size = ( (fsxfs_attributes_block_values_remote_t *) &( file_system_block->data[ values_offset ] ) )->name_size;
+			}
+			if( (size_t) entry_name_size > ( file_system_block->data_size - values_offset - values_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid name size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( (size_t) entry_name_size == name_size )
+			 && ( memory_compare(
+			       &( file_system_block->data[ values_offset + values_data_size ] ),
+			       name,
+			       name_size ) == 0 ) )
+			{
+				break;
+			}
+		}
+		if( ( entry_index < (int) number_of_entries )
+		 || ( entry_lower_index >= (int) number_of_entries ) )
+		{
+			/* Either a match was found or the name hash is not in the remaining leaf blocks
+			 */
+			if( ( entry_index < (int) number_of_entries )
+			 && ( entry_name_hash == name_hash ) )
+			{
+				if( libfsxfs_attributes_get_leaf_entry_values(
+				     block_number,
+				     file_system_block->data,
+				     file_system_block->data_size,
+				     (size_t) values_offset,
+				     flags,
+				     attribute_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute values of leaf entry: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				result = 1;
+			}
+		}
+		else if( file_system_block->header->next_block_number != 0 )
+		{
+			block_number    = file_system_block->header->next_block_number;
+			read_next_block = 1;
+		}
+		if( libfsxfs_file_system_block_free(
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system block.",
+			 function );
+
+			goto on_error;
+		}
+		if( read_next_block != 0 )
+		{
+			if( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid recursion depth value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			recursion_depth++;
+
+			if( libfsxfs_attributes_read_block(
+			     io_handle,
+			     file_io_handle,
+			     inode,
+			     block_number,
+			     &file_system_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read attributes block: %" PRIu32 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+		}
+	}
+	return( result );
+
+on_error:
+	if( *attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 attribute_values,
+		 NULL );
+	}
+	if( file_system_block != NULL )
+	{
+		libfsxfs_file_system_block_free(
+		 &file_system_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Splits an UTF-8 encoded extended attribute name into its namespace and name
+ * Returns 1 if successful, 0 if the name has no supported namespace prefix or -1 on error
+ */
+int libfsxfs_attributes_split_utf8_name(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *name_offset,
+     uint8_t *namespace_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_attributes_split_utf8_name";
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( namespace_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid namespace flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length >= 5 )
+	 && ( memory_compare(
+	       utf8_string,
+	       "user.",
+	       5 ) == 0 ) )
+	{
+		*name_offset     = 5;
+		*namespace_flags = 0;
+	}
+	else if( ( utf8_string_length >= 8 )
+	      && ( memory_compare(
+	            utf8_string,
+	            "trusted.",
+	            8 ) == 0 ) )
+	{
+		*name_offset     = 8;
+		*namespace_flags = 2;
+	}
+	else if( ( utf8_string_length >= 7 )
+	      && ( memory_compare(
+	            utf8_string,
+	            "secure.",
+	            7 ) == 0 ) )
+	{
+		*name_offset     = 7;
+		*namespace_flags = 4;
+	}
+	else
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the attribute values for an UTF-8 encoded name from the inode
+ * Only leaf and node attributes are looked up using the name hash, for inline attributes
+ * 0 is returned and all the extended attributes need to be read instead
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name";
+	size_t name_offset      = 0;
+	uint8_t namespace_flags = 0;
+	int result              = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->attributes_extents_array == NULL )
+	{
+		return( 0 );
+	}
+	result = libfsxfs_attributes_split_utf8_name(
+	          utf8_string,
+	          utf8_string_length,
+	          &name_offset,
+	          &namespace_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to split UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          &( utf8_string[ name_offset ] ),
+		          utf8_string_length - name_offset,
+		          namespace_flags,
+		          attribute_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid IO handle - unsupported format version.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute values from attributes blocks.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the attribute values for an UTF-16 encoded name from the inode
+ * Only leaf and node attributes are looked up using the name hash, for inline attributes
+ * 0 is returned and all the extended attributes need to be read instead
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_attributes_get_attribute_values_from_inode_by_utf16_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_string[ 264 + 4 ];
+	static char *function                        = "libfsxfs_attributes_get_attribute_values_from_inode_by_utf16_name";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf8_string_length                    = 0;
+	int result                                   = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->attributes_extents_array == NULL )
+	{
+		return( 0 );
+	}
+	/* The name hash is calculated over the UTF-8 encoded name as stored on disk
+	 */
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_unicode_character_copy_to_utf8(
+		     unicode_character,
+		     utf8_string,
+		     264 + 4,
+		     &utf8_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		/* Names longer than the longest namespace prefix and 255 bytes cannot be stored
+		 * in a leaf block entry
+		 */
+		if( utf8_string_length > 264 )
+		{
+			return( 0 );
+		}
+	}
+	result = libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          utf8_string,
+	          utf8_string_length,
+	          attribute_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values by UTF-8 name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Creates a data stream of the attribute value data
+ * The value data is only read when the data stream is read
+ * Make sure the value data_stream is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_attributes_get_value_data_stream(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     libfsxfs_attribute_values_t *attribute_values,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error )
+{
+	libfdata_stream_t *safe_data_stream = NULL;
+	libfsxfs_extent_t *extent           = NULL;
+	static char *function               = "libfsxfs_attributes_get_value_data_stream";
+	size64_t data_segment_size          = 0;
+	off64_t data_segment_offset         = 0;
+	off64_t value_data_offset           = 0;
+	size_t block_header_size            = 0;
+	uint64_t block_index                = 0;
+	uint64_t next_logical_block_number  = 0;
+	uint64_t relative_block_number      = 0;
+	uint32_t extent_block_offset        = 0;
+	uint32_t remaining_value_data_size  = 0;
+	int allocation_group_index          = 0;
+	int extent_index                    = 0;
+	int segment_index                   = 0;
+	int result                          = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_values->value_data_location == LIBFSXFS_VALUE_DATA_LOCATION_VALUE_DATA )
+	{
+		if( libfsxfs_data_stream_initialize_from_data(
+		     data_stream,
+		     attribute_values->value_data,
+		     (size_t) attribute_values->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( attribute_values->value_data_location == LIBFSXFS_VALUE_DATA_LOCATION_INLINE_DATA )
+	{
+		if( inode == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid inode.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( inode->inline_attributes_data == NULL )
+		 || ( attribute_values->value_data_offset > (size_t) inode->attributes_fork_size )
+		 || ( (size_t) attribute_values->value_data_size > ( (size_t) inode->attributes_fork_size - attribute_values->value_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid attribute values - value data offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* The data stream references the inline attributes data of the inode
+		 */
+		if( libfsxfs_data_stream_initialize_from_data(
+		     data_stream,
+		     &( inode->inline_attributes_data[ attribute_values->value_data_offset ] ),
+		     (size_t) attribute_values->value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data stream.",
 			 function );
 
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* Local value data is stored in the leaf block after the name,
+		 * remote value data starts at the start of the value data block
+		 */
+		if( attribute_values->value_data_location == LIBFSXFS_VALUE_DATA_LOCATION_LEAF_BLOCK )
+		{
+			if( ( attribute_values->value_data_offset >= (size_t) io_handle->block_size )
+			 || ( (size_t) attribute_values->value_data_size > ( (size_t) io_handle->block_size - attribute_values->value_data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid attribute values - value data offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			value_data_offset = (off64_t) attribute_values->value_data_offset;
+		}
+		result = libfsxfs_inode_get_attributes_extent_by_logical_block_number(
+		          inode,
+		          (uint64_t) attribute_values->value_data_block_number,
+		          &extent_index,
+		          &extent,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attributes extent for block number: %" PRIu32 ".",
+			 function,
+			 attribute_values->value_data_block_number );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid block number: %" PRIu32 " value out of bounds.",
+			 function,
+			 attribute_values->value_data_block_number );
+
 			return( -1 );
 		}
+		/* In format version 5 every remote value data block starts with a header
+		 */
+		if( ( attribute_values->value_data_location == LIBFSXFS_VALUE_DATA_LOCATION_REMOTE_BLOCKS )
+		 && ( io_handle->format_version == 5 ) )
+		{
+			block_header_size = sizeof( fsxfs_attributes_remote_value_data_block_header_v3_t );
+
+			if( block_header_size >= io_handle->block_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid IO handle - block size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+		}
 		if( libfdata_stream_initialize(
 		     &safe_data_stream,
 		     NULL,
@@ -1297,6 +2353,7 @@ int libfsxfs_attributes_get_value_data_stream(
 			goto on_error;
 		}
 		remaining_value_data_size = attribute_values->value_data_size;
+		extent_block_offset       = (uint32_t) ( attribute_values->value_data_block_number - extent->logical_block_number );
 
 		while( remaining_value_data_size > 0 )
 		{
@@ -1335,36 +2392,96 @@ int libfsxfs_attributes_get_value_data_stream(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+			/* The value data can start in the middle of the first extent
+			 */
+			relative_block_number += extent_block_offset;
+
 			data_segment_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
-			data_segment_size   = (size64_t) extent->number_of_blocks * io_handle->block_size;
 
-			if( data_segment_size > remaining_value_data_size )
+			if( block_header_size == 0 )
 			{
-				data_segment_size = remaining_value_data_size;
+				data_segment_size = (size64_t) ( extent->number_of_blocks - extent_block_offset ) * io_handle->block_size;
+
+				data_segment_offset += value_data_offset;
+				data_segment_size   -= value_data_offset;
+
+				if( data_segment_size > remaining_value_data_size )
+				{
+					data_segment_size = remaining_value_data_size;
+				}
+				if( libfdata_stream_append_segment(
+				     safe_data_stream,
+				     &segment_index,
+				     0,
+				     data_segment_offset,
+				     data_segment_size,
+				     extent->range_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append extent: %d data stream segment.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
+				remaining_value_data_size -= (uint32_t) data_segment_size;
 			}
-			if( libfdata_stream_append_segment(
-			     safe_data_stream,
-			     &segment_index,
-			     0,
-			     data_segment_offset,
-			     data_segment_size,
-			     extent->range_flags,
-			     error ) != 1 )
+			else
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append extent: %d data stream segment.",
-				 function,
-				 extent_index );
-
-				goto on_error;
+				/* Map the value data of every block in the extent directly after its header,
+				 * so that the value data is read without copying the blocks
+				 */
+				for( block_index = extent_block_offset;
+				     block_index < extent->number_of_blocks;
+				     block_index++ )
+				{
+					data_segment_size = (size64_t) ( io_handle->block_size - block_header_size );
+
+					if( data_segment_size > remaining_value_data_size )
+					{
+						data_segment_size = remaining_value_data_size;
+					}
+					if( libfdata_stream_append_segment(
+					     safe_data_stream,
+					     &segment_index,
+					     0,
+					     data_segment_offset + block_header_size,
+					     data_segment_size,
+					     extent->range_flags,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append extent: %d block: %" PRIu64 " data stream segment.",
+						 function,
+						 extent_index,
+						 block_index );
+
+						goto on_error;
+					}
+					remaining_value_data_size -= (uint32_t) data_segment_size;
+
+					if( remaining_value_data_size == 0 )
+					{
+						break;
+					}
+					data_segment_offset += io_handle->block_size;
+				}
 			}
-			remaining_value_data_size -= data_segment_size;
-
 			if( remaining_value_data_size > 0 )
 			{
+				next_logical_block_number = extent->logical_block_number + extent->number_of_blocks;
+				extent_block_offset       = 0;
+				value_data_offset         = 0;
+
+				extent_index++;
+
 				if( libfsxfs_inode_get_attributes_extent_by_index(
 				     inode,
 				     extent_index,
@@ -1381,6 +2498,21 @@ int libfsxfs_attributes_get_value_data_stream(
 
 					goto on_error;
 				}
+				/* The value data blocks are logically contiguous
+				 */
+				if( ( extent == NULL )
+				 || ( extent->logical_block_number != next_logical_block_number ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid extent: %d - logical block number value out of bounds.",
+					 function,
+					 extent_index );
+
+					goto on_error;
+				}
 			}
 		}
 		*data_stream = safe_data_stream;
@@ -27,6 +27,7 @@
 
 #include "libfsxfs_attribute_values.h"
 #include "libfsxfs_attributes_leaf_block_header.h"
+#include "libfsxfs_file_system_block.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
@@ -50,11 +51,20 @@ int libfsxfs_attributes_read_branch_values(
 
 int libfsxfs_attributes_read_leaf_values(
      libfsxfs_io_handle_t *io_handle,
+     uint32_t block_number,
      const uint8_t *data,
      size_t data_size,
      libcdata_array_t *extended_attributes_array,
      libcerror_error_t **error );
 
+int libfsxfs_attributes_read_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint32_t block_number,
+     libfsxfs_file_system_block_t **file_system_block,
+     libcerror_error_t **error );
+
 int libfsxfs_attributes_read_from_block(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
@@ -71,6 +81,50 @@ int libfsxfs_attributes_read_from_inode(
      libcdata_array_t *extended_attributes_array,
      libcerror_error_t **error );
 
+int libfsxfs_attributes_get_leaf_entry_values(
+     uint32_t block_number,
+     const uint8_t *data,
+     size_t data_size,
+     size_t values_offset,
+     uint8_t flags,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error );
+
+int libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *name,
+     size_t name_size,
+     uint8_t namespace_flags,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error );
+
+int libfsxfs_attributes_split_utf8_name(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *name_offset,
+     uint8_t *namespace_flags,
+     libcerror_error_t **error );
+
+int libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error );
+
+int libfsxfs_attributes_get_attribute_values_from_inode_by_utf16_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_attribute_values_t **attribute_values,
+     libcerror_error_t **error );
+
 int libfsxfs_attributes_get_value_data_stream(
      libfsxfs_io_handle_t *io_handle,
      libfsxfs_inode_t *inode,
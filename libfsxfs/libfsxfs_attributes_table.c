@@ -429,25 +429,13 @@ int libfsxfs_attributes_table_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( value_data_size > 0 )
-		{
-			if( libfsxfs_attribute_values_set_value_data(
-			     attribute_values,
-			     &( data[ data_offset ] ),
-			     (size_t) value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set value data.",
-				 function );
+		/* The value data is not copied but read from the inline attributes data when needed
+		 */
+		attribute_values->value_data_location = LIBFSXFS_VALUE_DATA_LOCATION_INLINE_DATA;
+		attribute_values->value_data_offset   = data_offset;
+		attribute_values->value_data_size     = (uint32_t) value_data_size;
 
-				goto on_error;
-			}
-			data_offset += value_data_size;
-		}
+		data_offset += value_data_size;
 		if( ( flags & 0x08 ) != 0 )
 		{
 			if( libfsxfs_attribute_values_free(
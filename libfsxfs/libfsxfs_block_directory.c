@@ -27,6 +27,7 @@
 #include "libfsxfs_block_directory.h"
 #include "libfsxfs_block_directory_footer.h"
 #include "libfsxfs_block_directory_header.h"
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
@@ -116,10 +117,10 @@ int libfsxfs_block_directory_initialize(
 
 		return( -1 );
 	}
-	( *block_directory )->data = (uint8_t *) memory_allocate(
-	                                          sizeof( uint8_t ) * block_size );
+	( *block_directory )->buffer = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * block_size );
 
-	if( ( *block_directory )->data == NULL )
+	if( ( *block_directory )->buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -130,6 +131,7 @@ int libfsxfs_block_directory_initialize(
 
 		goto on_error;
 	}
+	( *block_directory )->data      = ( *block_directory )->buffer;
 	( *block_directory )->data_size = block_size;
 
 	return( 1 );
@@ -201,7 +203,7 @@ int libfsxfs_block_directory_free(
 			}
 		}
 		memory_free(
-		 ( *block_directory )->data );
+		 ( *block_directory )->buffer );
 
 		memory_free(
 		 *block_directory );
@@ -234,6 +236,7 @@ int libfsxfs_block_directory_read_data(
 	uint16_t free_tag                           = 0;
 	uint8_t name_size                           = 0;
 	int entry_index                             = 0;
+	int result                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint16_t value_16bit                        = 0;
@@ -319,6 +322,41 @@ int libfsxfs_block_directory_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	/* The checksum covers the entire directory block
+	 */
+	if( ( io_handle->format_version == 5 )
+	 && ( io_handle->verify_checksums != 0 )
+	 && ( data_size == (size_t) io_handle->directory_block_size ) )
+	{
+		result = libfsxfs_checksum_verify_metadata(
+		          data,
+		          data_size,
+		          (size_t) ( ( (fsxfs_block_directory_header_v3_t *) data )->checksum - data ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify block directory checksum.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in block directory checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libfsxfs_block_directory_header_initialize(
 	     &( block_directory->header ),
 	     error ) != 1 )
@@ -725,8 +763,10 @@ int libfsxfs_block_directory_read_file_io_handle(
      libcdata_array_t *entries_array,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_block_directory_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function      = "libfsxfs_block_directory_read_file_io_handle";
+	const uint8_t *mapped_data = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
 
 	if( block_directory == NULL )
 	{
@@ -760,26 +800,57 @@ int libfsxfs_block_directory_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              block_directory->data,
-	              block_directory->data_size,
-	              file_offset,
-	              error );
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          block_directory->data_size,
+	          &mapped_data,
+	          error );
 
-	if( read_count != (ssize_t) block_directory->data_size )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read block directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		/* The block directory is parsed directly from the memory mapped volume data
+		 */
+		block_directory->data = (uint8_t *) mapped_data;
+	}
+	else
+	{
+		block_directory->data = block_directory->buffer;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              block_directory->buffer,
+		              block_directory->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) block_directory->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read block directory data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
 	if( libfsxfs_block_directory_read_data(
 	     block_directory,
 	     io_handle,
@@ -40,7 +40,7 @@ typedef struct libfsxfs_block_directory libfsxfs_block_directory_t;
 
 struct libfsxfs_block_directory
 {
-	/* Data
+	/* Data, which either refers to the buffer or the memory mapped volume data
 	 */
 	uint8_t *data;
 
@@ -48,6 +48,10 @@ struct libfsxfs_block_directory
 	 */
 	size_t data_size;
 
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
 	/* The header
 	 */
 	libfsxfs_block_directory_header_t *header;
@@ -24,6 +24,7 @@
 #include <types.h>
 
 #include "libfsxfs_btree_block.h"
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
@@ -110,20 +111,6 @@ int libfsxfs_btree_block_initialize(
 
 		return( -1 );
 	}
-	( *btree_block )->data = (uint8_t *) memory_allocate(
-	                                      sizeof( uint8_t ) * block_size );
-
-	if( ( *btree_block )->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create B+ tree block data.",
-		 function );
-
-		goto on_error;
-	}
 	( *btree_block )->data_size              = block_size;
 	( *btree_block )->block_number_data_size = block_number_data_size;
 
@@ -179,9 +166,11 @@ int libfsxfs_btree_block_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 ( *btree_block )->data );
-
+		if( ( *btree_block )->buffer != NULL )
+		{
+			memory_free(
+			 ( *btree_block )->buffer );
+		}
 		memory_free(
 		 *btree_block );
 
@@ -201,7 +190,9 @@ int libfsxfs_btree_block_read_data(
      libcerror_error_t **error )
 {
 	static char *function   = "libfsxfs_btree_block_read_data";
+	size_t checksum_offset  = 0;
 	size_t header_data_size = 0;
+	int result              = 0;
 
 	if( btree_block == NULL )
 	{
@@ -281,6 +272,46 @@ int libfsxfs_btree_block_read_data(
 
 		return( -1 );
 	}
+	if( ( io_handle->format_version == 5 )
+	 && ( io_handle->verify_checksums != 0 ) )
+	{
+		if( btree_block->block_number_data_size == 8 )
+		{
+			checksum_offset = (size_t) ( ( (fsxfs_btree_header_v5_64bit_t *) data )->checksum - data );
+		}
+		else
+		{
+			checksum_offset = (size_t) ( ( (fsxfs_btree_header_v5_32bit_t *) data )->checksum - data );
+		}
+		result = libfsxfs_checksum_verify_metadata(
+		          data,
+		          data_size,
+		          checksum_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify B+ tree block checksum.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in B+ tree block checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( libfsxfs_btree_header_initialize(
 	     &( btree_block->header ),
 	     error ) != 1 )
@@ -349,8 +380,10 @@ int libfsxfs_btree_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_btree_block_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function      = "libfsxfs_btree_block_read_file_io_handle";
+	const uint8_t *mapped_data = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
 
 	if( btree_block == NULL )
 	{
@@ -384,26 +417,76 @@ int libfsxfs_btree_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              btree_block->data,
-	              btree_block->data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) btree_block->data_size )
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          btree_block->data_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		/* The B+ tree block is parsed directly from the memory mapped volume data
+		 */
+		btree_block->data = (uint8_t *) mapped_data;
+	}
+	else
+	{
+		/* The buffer is only allocated when the block is not memory mapped
+		 */
+		if( btree_block->buffer == NULL )
+		{
+			btree_block->buffer = (uint8_t *) memory_allocate(
+			                                   sizeof( uint8_t ) * btree_block->data_size );
+
+			if( btree_block->buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create B+ tree block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		btree_block->data = btree_block->buffer;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              btree_block->buffer,
+		              btree_block->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) btree_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read B+ tree block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
 	if( libfsxfs_btree_block_read_data(
 	     btree_block,
 	     io_handle,
@@ -269,6 +269,19 @@ int libfsxfs_btree_header_read_data(
 	 ( (fsxfs_btree_header_v1_32bit_t *) data )->number_of_records,
 	 btree_header->number_of_records );
 
+	if( block_number_data_size == 4 )
+	{
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_btree_header_v1_32bit_t *) data )->next_btree_block_number,
+		 btree_header->next_btree_block_number );
+	}
+	else
+	{
+		byte_stream_copy_to_uint64_big_endian(
+		 ( (fsxfs_btree_header_v1_64bit_t *) data )->next_btree_block_number,
+		 btree_header->next_btree_block_number );
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -307,22 +320,10 @@ int libfsxfs_btree_header_read_data(
 		 function,
 		 value_64bit );
 
-		if( block_number_data_size == 4 )
-		{
-			byte_stream_copy_to_uint32_big_endian(
-			 ( (fsxfs_btree_header_v1_32bit_t *) data )->next_btree_block_number,
-			 value_64bit );
-		}
-		else
-		{
-			byte_stream_copy_to_uint64_big_endian(
-			 ( (fsxfs_btree_header_v1_64bit_t *) data )->next_btree_block_number,
-			 value_64bit );
-		}
 		libcnotify_printf(
 		 "%s: next B+ tree block number\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 btree_header->next_btree_block_number );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
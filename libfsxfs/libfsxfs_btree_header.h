@@ -47,6 +47,10 @@ struct libfsxfs_btree_header
 	/* Number of records
 	 */
 	uint16_t number_of_records;
+
+	/* Next B+ tree block number
+	 */
+	uint64_t next_btree_block_number;
 };
 
 int libfsxfs_btree_header_initialize(
@@ -0,0 +1,390 @@
+/*
+ * Cache shard functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_cache_shard.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
+
+/* Creates a cache shard
+ * A cache shard is a cache with its own read/write lock, so that threads that
+ * access different shards do not have to wait for each other
+ * Make sure the value cache_shard is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_cache_shard_initialize(
+     libfsxfs_cache_shard_t **cache_shard,
+     int maximum_number_of_cache_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_cache_shard_initialize";
+
+	if( cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_shard != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache shard value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cache_values <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of cache values value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_shard = memory_allocate_structure(
+	                libfsxfs_cache_shard_t );
+
+	if( *cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache shard.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_shard,
+	     0,
+	     sizeof( libfsxfs_cache_shard_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache shard.",
+		 function );
+
+		memory_free(
+		 *cache_shard );
+
+		*cache_shard = NULL;
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *cache_shard )->cache ),
+	     maximum_number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *cache_shard )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *cache_shard )->maximum_number_of_cache_values = maximum_number_of_cache_values;
+
+	return( 1 );
+
+on_error:
+	if( *cache_shard != NULL )
+	{
+		if( ( *cache_shard )->cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *cache_shard )->cache ),
+			 NULL );
+		}
+		memory_free(
+		 *cache_shard );
+
+		*cache_shard = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a cache shard
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_cache_shard_free(
+     libfsxfs_cache_shard_t **cache_shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_cache_shard_free";
+	int result            = 1;
+
+	if( cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_shard != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *cache_shard )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libfcache_cache_free(
+		     &( ( *cache_shard )->cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *cache_shard );
+
+		*cache_shard = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a cache shard for exclusive use
+ * The cache and the statistics of the shard can only be accessed while the shard is grabbed,
+ * note that retrieving a value from the cache also changes the cache since it tracks
+ * the most recently used value
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_cache_shard_grab(
+     libfsxfs_cache_shard_t *cache_shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_cache_shard_grab";
+
+	if( cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache shard.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     cache_shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a cache shard that was grabbed for exclusive use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_cache_shard_release(
+     libfsxfs_cache_shard_t *cache_shard,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_cache_shard_release";
+
+	if( cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache shard.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     cache_shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the cache statistics of the cache shard
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_cache_shard_get_statistics(
+     libfsxfs_cache_shard_t *cache_shard,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_cache_shard_get_statistics";
+
+	if( cache_shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     cache_shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_hits      = cache_shard->number_of_hits;
+	*number_of_misses    = cache_shard->number_of_misses;
+	*number_of_evictions = cache_shard->number_of_evictions;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     cache_shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Cache shard functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_CACHE_SHARD_H )
+#define _LIBFSXFS_CACHE_SHARD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_cache_shard libfsxfs_cache_shard_t;
+
+struct libfsxfs_cache_shard
+{
+	/* The cache
+	 */
+	libfcache_cache_t *cache;
+
+	/* The maximum number of cache values
+	 */
+	int maximum_number_of_cache_values;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of cache values that were replaced by a new value
+	 */
+	uint64_t number_of_evictions;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_cache_shard_initialize(
+     libfsxfs_cache_shard_t **cache_shard,
+     int maximum_number_of_cache_values,
+     libcerror_error_t **error );
+
+int libfsxfs_cache_shard_free(
+     libfsxfs_cache_shard_t **cache_shard,
+     libcerror_error_t **error );
+
+int libfsxfs_cache_shard_grab(
+     libfsxfs_cache_shard_t *cache_shard,
+     libcerror_error_t **error );
+
+int libfsxfs_cache_shard_release(
+     libfsxfs_cache_shard_t *cache_shard,
+     libcerror_error_t **error );
+
+int libfsxfs_cache_shard_get_statistics(
+     libfsxfs_cache_shard_t *cache_shard,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_CACHE_SHARD_H ) */
+
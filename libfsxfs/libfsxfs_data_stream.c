@@ -20,14 +20,15 @@
  */
 
 #include <common.h>
+#include <memory.h>
 #include <types.h>
 
-#include "libfsxfs_block_data_handle.h"
 #include "libfsxfs_buffer_data_handle.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libfdata.h"
@@ -134,235 +135,315 @@ on_error:
 	return( -1 );
 }
 
-/* Creates data data stream from extents
- * Make sure the value data_stream is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+/* Maps the start of a logical data range onto a physical range
+ * The physical range is the largest range that starts at the offset, does not
+ * exceed the size and is stored contiguously in one or more extents
+ * Data that is not covered by an extent is mapped as sparse
+ * If the data extents of the inode have not been read, the extents are looked
+ * up in the extent B+ tree, which is read using the file IO handle
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
  */
-int libfsxfs_data_stream_initialize_from_extents(
-     libfdata_stream_t **data_stream,
+int libfsxfs_data_stream_map_range(
      libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     off64_t offset,
+     size64_t size,
+     off64_t *physical_offset,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	libfsxfs_extent_t *extent           = NULL;
-	static char *function               = "libfsxfs_data_stream_initialize_from_extents";
-	size64_t data_segment_size          = 0;
-	off64_t data_segment_offset         = 0;
-	uint64_t relative_block_number      = 0;
-	int allocation_group_index          = 0;
-	int extent_index                    = 0;
-	int number_of_extents               = 0;
-	int segment_index                   = 0;
+	libfsxfs_extent_t extent;
+	libfsxfs_extent_t next_extent;
+
+	static char *function              = "libfsxfs_data_stream_map_range";
+	size64_t segment_data_offset       = 0;
+	size64_t segment_data_size         = 0;
+	off64_t extent_offset              = 0;
+	off64_t next_extent_offset         = 0;
+	uint64_t logical_block_number      = 0;
+	uint64_t next_logical_block_number = 0;
+	uint64_t relative_block_number     = 0;
+	int allocation_group_index         = 0;
+	int result                         = 0;
 
-	if( data_stream == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data stream.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid inode.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->allocation_group_size == 0 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - allocation group size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
+	if( physical_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical offset.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_stream_initialize(
-	     &safe_data_stream,
-	     NULL,
-	     NULL,
-	     NULL,
-	     NULL,
-	     (ssize_t (*)(intptr_t *, intptr_t *, int, int, uint8_t *, size_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsxfs_block_data_handle_read_segment_data,
-	     NULL,
-	     (off64_t (*)(intptr_t *, intptr_t *, int, int, off64_t, libcerror_error_t **)) &libfsxfs_block_data_handle_seek_segment_offset,
-	     0,
-	     error ) != 1 )
+	if( mapped_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped size.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( (size64_t) offset >= data_size ) )
+	{
+		return( 0 );
+	}
+	/* The mapped range should not contain the data beyond the end of the data
+	 * in the last block
+	 */
+	if( size > ( data_size - offset ) )
+	{
+		size = data_size - offset;
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		*physical_offset = 0;
+		*mapped_size     = size;
+		*range_flags     = LIBFSXFS_EXTENT_FLAG_IS_INLINE;
+
+		return( 1 );
+	}
+	if( io_handle->allocation_group_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - allocation group size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_inode_get_number_of_data_extents(
-	     inode,
-	     &number_of_extents,
-	     error ) != 1 )
+	logical_block_number = (uint64_t) offset / io_handle->block_size;
+
+	result = libfsxfs_inode_lookup_data_extent_by_logical_block_number(
+	          inode,
+	          io_handle,
+	          file_io_handle,
+	          logical_block_number,
+	          &extent,
+	          &next_logical_block_number,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data extents.",
-		 function );
+		 "%s: unable to retrieve data extent for logical block number: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( extent_index = 0;
-	     extent_index < number_of_extents;
-	     extent_index++ )
+	else if( result == 0 )
 	{
-		if( libfsxfs_inode_get_data_extent_by_index(
-		     inode,
-		     extent_index,
-		     &extent,
-		     error ) != 1 )
+		/* Data that is not covered by an extent is sparse up to the next extent
+		 */
+		if( next_logical_block_number != (uint64_t) 0xffffffffffffffffUL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extent: %d.",
-			 function,
-			 extent_index );
+			segment_data_size = ( ( next_logical_block_number - logical_block_number ) * io_handle->block_size )
+			                  - ( (uint64_t) offset % io_handle->block_size );
 
-			goto on_error;
+			if( size > segment_data_size )
+			{
+				size = segment_data_size;
+			}
 		}
-		if( extent == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing extent: %d.",
-			 function,
-			 extent_index );
+		*physical_offset = 0;
+		*range_flags     = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
+	}
+	else
+	{
+		segment_data_offset = ( ( logical_block_number - extent.logical_block_number ) * io_handle->block_size )
+		                    + ( (uint64_t) offset % io_handle->block_size );
+		segment_data_size   = ( (size64_t) extent.number_of_blocks * io_handle->block_size ) - segment_data_offset;
 
-			goto on_error;
+		if( ( extent.range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			*physical_offset = 0;
 		}
-		allocation_group_index = (int) ( extent->physical_block_number >> io_handle->number_of_relative_block_number_bits );
-		relative_block_number  = extent->physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else
 		{
-			libcnotify_printf(
-			 "%s: extent: %d allocation group index\t: %d\n",
-			 function,
-			 extent_index,
-			 allocation_group_index );
+			allocation_group_index = (int) ( extent.physical_block_number >> io_handle->number_of_relative_block_number_bits );
+			relative_block_number  = extent.physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
 
-			libcnotify_printf(
-			 "%s: extent: %d relative block number\t: %" PRIu64 "\n",
-			 function,
-			 extent_index,
-			 relative_block_number );
+			extent_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
 
-			libcnotify_printf(
-			 "\n" );
+			*physical_offset = extent_offset + segment_data_offset;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		data_segment_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
-		data_segment_size   = (size64_t) extent->number_of_blocks * io_handle->block_size;
-
-		if( libfdata_stream_append_segment(
-		     safe_data_stream,
-		     &segment_index,
-		     0,
-		     data_segment_offset,
-		     data_segment_size,
-		     extent->range_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append extent: %d data stream segment.",
-			 function,
-			 extent_index );
+		*range_flags = extent.range_flags;
 
-			goto on_error;
+		/* Subsequent extents that continue the range both logically and physically
+		 * are mapped as part of the range, so that the range can be read at once
+		 */
+		while( size > segment_data_size )
+		{
+			logical_block_number = extent.logical_block_number + extent.number_of_blocks;
+
+			result = libfsxfs_inode_lookup_data_extent_by_logical_block_number(
+			          inode,
+			          io_handle,
+			          file_io_handle,
+			          logical_block_number,
+			          &next_extent,
+			          &next_logical_block_number,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data extent for logical block number: %" PRIu64 ".",
+				 function,
+				 logical_block_number );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( ( next_extent.logical_block_number != logical_block_number )
+			 || ( next_extent.range_flags != extent.range_flags ) )
+			{
+				break;
+			}
+			if( ( next_extent.range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 )
+			{
+				allocation_group_index = (int) ( next_extent.physical_block_number >> io_handle->number_of_relative_block_number_bits );
+				relative_block_number  = next_extent.physical_block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+				next_extent_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+				if( next_extent_offset != ( extent_offset + ( (off64_t) extent.number_of_blocks * io_handle->block_size ) ) )
+				{
+					break;
+				}
+				extent_offset = next_extent_offset;
+			}
+			segment_data_size += (size64_t) next_extent.number_of_blocks * io_handle->block_size;
+
+			extent = next_extent;
+		}
+		if( size > segment_data_size )
+		{
+			size = segment_data_size;
 		}
 	}
-	if( libfdata_stream_set_mapped_size(
-	     safe_data_stream,
-	     data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set mapped size of data stream.",
-		 function );
-
-		goto on_error;
-	}
-	*data_stream = safe_data_stream;
+	*mapped_size = size;
 
 	return( 1 );
-
-on_error:
-	if( safe_data_stream != NULL )
-	{
-		libfdata_stream_free(
-		 &safe_data_stream,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Creates a data stream
- * Make sure the value data_stream is referencing, is set to NULL
- * Returns 1 if successful or -1 on error
+/* Reads the data of an inode at a specific offset into a buffer
+ * Unlike a data stream this function does not maintain a current offset and
+ * reads the segment data at a specific offset of the file IO handle, hence it
+ * can be called by multiple threads concurrently
+ * Returns the number of bytes read or -1 on error
  */
-int libfsxfs_data_stream_initialize(
-     libfdata_stream_t **data_stream,
-     libfsxfs_io_handle_t *io_handle,
-     libfsxfs_inode_t *inode,
-     size64_t data_size,
-     libcerror_error_t **error )
+ssize_t libfsxfs_data_stream_read_buffer_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         libfsxfs_inode_t *inode,
+         size64_t data_size,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream = NULL;
-	static char *function               = "libfsxfs_data_stream_initialize";
-	int result                          = 0;
+	static char *function  = "libfsxfs_data_stream_read_buffer_at_offset";
+	size64_t mapped_size   = 0;
+	size_t buffer_offset   = 0;
+	size_t read_size       = 0;
+	ssize_t read_count     = 0;
+	off64_t segment_offset = 0;
+	uint32_t range_flags   = 0;
 
-	if( data_stream == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data stream.",
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -378,59 +459,145 @@ int libfsxfs_data_stream_initialize(
 
 		return( -1 );
 	}
-	if( ( inode->fork_type != LIBFSXFS_FORK_TYPE_INLINE_DATA )
-	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
-	 && ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported directory data fork type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size == 0 )
-	 || ( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA ) )
-	{
-		result = libfsxfs_data_stream_initialize_from_data(
-		          &safe_data_stream,
-		          inode->inline_data,
-		          (size_t) data_size,
-		          error );
-	}
-	else
+	if( buffer_size > (size_t) SSIZE_MAX )
 	{
-		result = libfsxfs_data_stream_initialize_from_extents(
-		          &safe_data_stream,
-		          io_handle,
-		          inode,
-		          data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( result != 1 )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*data_stream = safe_data_stream;
+	if( (size64_t) offset >= data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( data_size - offset ) )
+	{
+		buffer_size = (size_t) ( data_size - offset );
+	}
+	if( inode->fork_type == LIBFSXFS_FORK_TYPE_INLINE_DATA )
+	{
+		if( inode->inline_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid inode - missing inline data.",
+			 function );
 
-	return( 1 );
+			return( -1 );
+		}
+		if( memory_copy(
+		     buffer,
+		     &( inode->inline_data[ offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inline data.",
+			 function );
 
-on_error:
-	if( safe_data_stream != NULL )
+			return( -1 );
+		}
+		return( (ssize_t) buffer_size );
+	}
+	while( buffer_offset < buffer_size )
 	{
-		libfdata_stream_free(
-		 &safe_data_stream,
-		 NULL );
+		if( libfsxfs_data_stream_map_range(
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     data_size,
+		     offset,
+		     (size64_t) ( buffer_size - buffer_offset ),
+		     &segment_offset,
+		     &mapped_size,
+		     &range_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to map range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		read_size = (size_t) mapped_size;
+
+		if( ( range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              segment_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read segment data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 segment_offset,
+				 segment_offset );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
 	}
-	return( -1 );
+	return( (ssize_t) buffer_offset );
 }
-
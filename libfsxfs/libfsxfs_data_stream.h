@@ -41,19 +41,27 @@ int libfsxfs_data_stream_initialize_from_data(
      size64_t data_size,
      libcerror_error_t **error );
 
-int libfsxfs_data_stream_initialize_from_extents(
-     libfdata_stream_t **data_stream,
+int libfsxfs_data_stream_map_range(
      libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
      libfsxfs_inode_t *inode,
      size64_t data_size,
+     off64_t offset,
+     size64_t size,
+     off64_t *physical_offset,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
      libcerror_error_t **error );
 
-int libfsxfs_data_stream_initialize(
-     libfdata_stream_t **data_stream,
-     libfsxfs_io_handle_t *io_handle,
-     libfsxfs_inode_t *inode,
-     size64_t data_size,
-     libcerror_error_t **error );
+ssize_t libfsxfs_data_stream_read_buffer_at_offset(
+         libfsxfs_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         libfsxfs_inode_t *inode,
+         size64_t data_size,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
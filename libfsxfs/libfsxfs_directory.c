@@ -40,6 +40,7 @@
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_name_hash.h"
 
 #include "fsxfs_directory_block.h"
 #include "fsxfs_file_system_block.h"
@@ -742,7 +743,7 @@ int libfsxfs_directory_read_from_block(
 	uint64_t relative_block_number                  = 0;
 	int allocation_group_index                      = 0;
 	int extent_index                                = 0;
-	int number_of_extents                           = 0;
+	int result                                      = 0;
 
 	if( io_handle == NULL )
 	{
@@ -755,61 +756,26 @@ int libfsxfs_directory_read_from_block(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_get_number_of_data_extents(
-	     inode,
-	     &number_of_extents,
-	     error ) != 1 )
+	result = libfsxfs_inode_get_data_extent_by_logical_block_number(
+	          inode,
+	          (uint64_t) block_number,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of data extents.",
-		 function );
+		 "%s: unable to retrieve data extent for block number: %" PRIu32 ".",
+		 function,
+		 block_number );
 
 		goto on_error;
 	}
-/* TODO optimize this lookup */
-
-	for( extent_index = 0;
-	     extent_index < number_of_extents;
-	     extent_index++ )
-	{
-		if( libfsxfs_inode_get_data_extent_by_index(
-		     inode,
-		     extent_index,
-		     &extent,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extent: %d.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
-		if( extent == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing extent: %d.",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
-		if( ( block_number >= extent->logical_block_number )
-		 && ( block_number < ( extent->logical_block_number + extent->number_of_blocks ) ) )
-		{
-			break;
-		}
-	}
-	if( extent_index >= number_of_extents )
+	else if( result == 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1743,3 +1709,1611 @@ int libfsxfs_directory_get_entry_by_utf16_name(
 	return( 0 );
 }
 
+
+/* Retrieves the file offset of a specific (logical) directory block number
+ * Returns 1 if successful, 0 if the block number is not mapped or -1 on error
+ */
+int libfsxfs_directory_get_block_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     off64_t *block_offset,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent      = NULL;
+	static char *function          = "libfsxfs_directory_get_block_offset";
+	uint64_t physical_block_number = 0;
+	uint64_t relative_block_number = 0;
+	int allocation_group_index     = 0;
+	int extent_index               = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_inode_get_data_extent_by_logical_block_number(
+	          inode,
+	          block_number,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extent for block number: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	allocation_group_index = (int) ( extent->physical_block_number >> io_handle->number_of_relative_block_number_bits );
+	relative_block_number  = extent->physical_block_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+	physical_block_number = ( (uint64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number;
+
+	if( ( block_number - extent->logical_block_number ) > ( UINT64_MAX - physical_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid physical block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	physical_block_number += block_number - extent->logical_block_number;
+
+	if( physical_block_number > ( (uint64_t) INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid physical block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*block_offset = (off64_t) physical_block_number * io_handle->block_size;
+
+	return( 1 );
+}
+
+/* Retrieves the first mapped directory data block number equal to or greater than a specific directory data block number
+ * The directory data block numbers are in units of the directory block size
+ * Returns 1 if successful, 0 if no such block or -1 on error
+ */
+int libfsxfs_directory_get_next_data_block_number(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     uint64_t *next_block_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent                     = NULL;
+	static char *function                         = "libfsxfs_directory_get_next_data_block_number";
+	uint64_t extent_end_block_number              = 0;
+	uint64_t first_block_number                   = 0;
+	uint64_t leaf_block_number                    = 0;
+	uint64_t safe_next_block_number               = 0;
+	uint32_t number_of_blocks_per_directory_block = 0;
+	int extent_index                              = 0;
+	int number_of_extents                         = 0;
+	int result                                    = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next block number.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_blocks_per_directory_block = io_handle->directory_block_size / io_handle->block_size;
+
+	leaf_block_number = LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size;
+
+	if( block_number >= ( leaf_block_number / number_of_blocks_per_directory_block ) )
+	{
+		return( 0 );
+	}
+	first_block_number = block_number * number_of_blocks_per_directory_block;
+
+	/* The extents are stored in ascending order of logical block number, hence the search
+	 * can start at the extent that contains or follows the first block of the directory block
+	 */
+	result = libfsxfs_inode_get_data_extent_by_logical_block_number(
+	          inode,
+	          first_block_number,
+	          &extent_index,
+	          &extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extent for block number: %" PRIu64 ".",
+		 function,
+		 first_block_number );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_get_number_of_data_extents(
+	     inode,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data extents.",
+		 function );
+
+		return( -1 );
+	}
+	result = 0;
+
+	while( extent_index < number_of_extents )
+	{
+		if( libfsxfs_inode_get_data_extent_by_index(
+		     inode,
+		     extent_index,
+		     &extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( extent->logical_block_number >= leaf_block_number )
+		{
+			break;
+		}
+		extent_end_block_number = extent->logical_block_number + extent->number_of_blocks;
+
+		/* Directory data blocks start at a directory block size boundary
+		 */
+		if( extent->logical_block_number > first_block_number )
+		{
+			safe_next_block_number = extent->logical_block_number + number_of_blocks_per_directory_block - 1;
+			safe_next_block_number = safe_next_block_number / number_of_blocks_per_directory_block;
+		}
+		else
+		{
+			safe_next_block_number = block_number;
+		}
+		if( ( safe_next_block_number * number_of_blocks_per_directory_block ) < extent_end_block_number )
+		{
+			*next_block_number = safe_next_block_number;
+
+			result = 1;
+
+			break;
+		}
+		extent_index++;
+	}
+	return( result );
+}
+
+/* Reads the directory entries from a specific directory data block
+ * The directory data block number is in units of the directory block size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_read_data_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_block_directory_t *block_directory = NULL;
+	static char *function                       = "libfsxfs_directory_read_data_block";
+	off64_t block_offset                        = 0;
+	int result                                  = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number > ( UINT64_MAX / ( io_handle->directory_block_size / io_handle->block_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_directory_get_block_offset(
+	          io_handle,
+	          inode,
+	          block_number * ( io_handle->directory_block_size / io_handle->block_size ),
+	          &block_offset,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset of data block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_initialize(
+	     &block_directory,
+	     io_handle->directory_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize block directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_read_file_io_handle(
+	     block_directory,
+	     io_handle,
+	     file_io_handle,
+	     block_offset,
+	     entries_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_block_directory_free(
+	     &block_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_directory != NULL )
+	{
+		libfsxfs_block_directory_free(
+		 &block_directory,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 entries_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads a directory hash (leaf or node) block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_read_hash_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     libfsxfs_file_system_block_t **file_system_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_directory_read_hash_block";
+	off64_t block_offset  = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_system_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_directory_get_block_offset(
+	          io_handle,
+	          inode,
+	          block_number,
+	          &block_offset,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve offset of block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_system_block_initialize(
+	     file_system_block,
+	     io_handle->directory_block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file system block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_system_block_read_file_io_handle(
+	     *file_system_block,
+	     io_handle,
+	     file_io_handle,
+	     block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 block_offset,
+		 block_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_system_block != NULL )
+	{
+		libfsxfs_file_system_block_free(
+		 file_system_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entry for a specific name from the directory hash (leaf and node) blocks
+ * The name is an UTF-8 encoded byte stream without end of string character
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_get_entry_from_hash_blocks_by_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *entries_array                   = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry  = NULL;
+	libfsxfs_file_system_block_t *file_system_block   = NULL;
+	fsxfs_directory_hash_block_entry_v2_t *hash_entry = NULL;
+	static char *function                             = "libfsxfs_directory_get_entry_from_hash_blocks_by_name";
+	size_t data_offset                                = 0;
+	size_t entries_data_size                          = 0;
+	size_t header_data_size                           = 0;
+	uint64_t block_number                             = 0;
+	uint64_t data_block_number                        = 0;
+	uint64_t last_data_block_number                   = 0;
+	uint32_t data_address                             = 0;
+	uint32_t entry_name_hash                          = 0;
+	uint32_t name_hash                                = 0;
+	uint16_t number_of_entries                        = 0;
+	int directory_entry_index                         = 0;
+	int entry_index                                   = 0;
+	int entry_lower_index                             = 0;
+	int entry_middle_index                            = 0;
+	int entry_upper_index                             = 0;
+	int has_data_block                                = 0;
+	int number_of_directory_entries                   = 0;
+	int read_next_block                               = 0;
+	int recursion_depth                               = 0;
+	int result                                        = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->block_size == 0 )
+	 || ( io_handle->directory_block_size < io_handle->block_size )
+	 || ( ( io_handle->directory_block_size % io_handle->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_name_hash_calculate(
+	     &name_hash,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->format_version == 5 )
+	{
+		header_data_size = sizeof( fsxfs_file_system_block_header_v3_t );
+	}
+	else
+	{
+		header_data_size = sizeof( fsxfs_file_system_block_header_v1_t );
+	}
+	block_number = LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size;
+
+	/* Descend the node blocks to the leaf block that contains the name hash
+	 */
+	for( recursion_depth = 0;
+	     recursion_depth <= LIBFSXFS_MAXIMUM_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( libfsxfs_directory_read_hash_block(
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     block_number,
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hash block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		if( ( file_system_block->header->signature == 0xd2f1 )
+		 || ( file_system_block->header->signature == 0xd2ff )
+		 || ( file_system_block->header->signature == 0x3df1 )
+		 || ( file_system_block->header->signature == 0x3dff ) )
+		{
+			break;
+		}
+		if( ( file_system_block->header->signature != 0xfebe )
+		 && ( file_system_block->header->signature != 0x3ebe ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature: 0x%04" PRIx16 ".",
+			 function,
+			 file_system_block->header->signature );
+
+			goto on_error;
+		}
+		data_offset = header_data_size;
+
+		if( io_handle->format_version == 5 )
+		{
+			entries_data_size = sizeof( fsxfs_directory_branch_block_header_v3_t );
+		}
+		else
+		{
+			entries_data_size = sizeof( fsxfs_directory_branch_block_header_v1_t );
+		}
+		if( entries_data_size > ( file_system_block->data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file system block - data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_directory_branch_block_header_v1_t *) &( file_system_block->data[ data_offset ] ) )->number_of_entries,
+		 number_of_entries );
+
+		data_offset += entries_data_size;
+
+		entries_data_size = sizeof( fsxfs_directory_branch_block_entry_v1_t ) * number_of_entries;
+
+		if( ( number_of_entries == 0 )
+		 || ( entries_data_size > ( file_system_block->data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* The node entry that covers the name hash is the first entry with a name hash
+		 * equal to or greater than the name hash or the last entry otherwise
+		 */
+		entry_lower_index = 0;
+		entry_upper_index = (int) number_of_entries - 1;
+
+		while( entry_lower_index < entry_upper_index )
+		{
+			entry_middle_index = entry_lower_index + ( ( entry_upper_index - entry_lower_index ) / 2 );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 ( (fsxfs_directory_branch_block_entry_v1_t *) &( file_system_block->data[ data_offset + ( entry_middle_index * sizeof( fsxfs_directory_branch_block_entry_v1_t ) ) ] ) )->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash < name_hash )
+			{
+				entry_lower_index = entry_middle_index + 1;
+			}
+			else
+			{
+				entry_upper_index = entry_middle_index;
+			}
+		}
+		data_offset += entry_lower_index * sizeof( fsxfs_directory_branch_block_entry_v1_t );
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_directory_branch_block_entry_v1_t *) &( file_system_block->data[ data_offset ] ) )->sub_block_number,
+		 block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: name hash: 0x%08" PRIx32 " in node entry: %d with sub block number: %" PRIu64 "\n",
+			 function,
+			 name_hash,
+			 entry_lower_index,
+			 block_number );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( libfsxfs_file_system_block_free(
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( file_system_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &entries_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Scan the leaf block entries with a matching name hash, entries with the same
+	 * name hash can continue in the next leaf block
+	 */
+	while( file_system_block != NULL )
+	{
+		if( ( file_system_block->header->signature != 0xd2f1 )
+		 && ( file_system_block->header->signature != 0xd2ff )
+		 && ( file_system_block->header->signature != 0x3df1 )
+		 && ( file_system_block->header->signature != 0x3dff ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature: 0x%04" PRIx16 ".",
+			 function,
+			 file_system_block->header->signature );
+
+			goto on_error;
+		}
+		data_offset = header_data_size;
+
+		if( io_handle->format_version == 5 )
+		{
+			entries_data_size = sizeof( fsxfs_directory_hash_block_header_v3_t );
+		}
+		else
+		{
+			entries_data_size = sizeof( fsxfs_directory_hash_block_header_v2_t );
+		}
+		if( entries_data_size > ( file_system_block->data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file system block - data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint16_big_endian(
+		 ( (fsxfs_directory_hash_block_header_v2_t *) &( file_system_block->data[ data_offset ] ) )->number_of_entries,
+		 number_of_entries );
+
+		data_offset += entries_data_size;
+
+		entries_data_size = sizeof( fsxfs_directory_hash_block_entry_v2_t ) * number_of_entries;
+
+		if( entries_data_size > ( file_system_block->data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the first entry with a name hash equal to or greater than the name hash
+		 */
+		entry_lower_index = 0;
+		entry_upper_index = (int) number_of_entries;
+
+		while( entry_lower_index < entry_upper_index )
+		{
+			entry_middle_index = entry_lower_index + ( ( entry_upper_index - entry_lower_index ) / 2 );
+
+			hash_entry = (fsxfs_directory_hash_block_entry_v2_t *) &( file_system_block->data[ data_offset + ( entry_middle_index * sizeof( fsxfs_directory_hash_block_entry_v2_t ) ) ] );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 hash_entry->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash < name_hash )
+			{
+				entry_lower_index = entry_middle_index + 1;
+			}
+			else
+			{
+				entry_upper_index = entry_middle_index;
+			}
+		}
+		read_next_block = 0;
+
+		for( entry_index = entry_lower_index;
+		     entry_index < (int) number_of_entries;
+		     entry_index++ )
+		{
+			hash_entry = (fsxfs_directory_hash_block_entry_v2_t *) &( file_system_block->data[ data_offset + ( entry_index * sizeof( fsxfs_directory_hash_block_entry_v2_t ) ) ] );
+
+			byte_stream_copy_to_uint32_big_endian(
+			 hash_entry->name_hash,
+			 entry_name_hash );
+
+			if( entry_name_hash != name_hash )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint32_big_endian(
+			 hash_entry->data_address,
+			 data_address );
+
+			/* A data address of 0 indicates a stale entry
+			 */
+			if( data_address == 0 )
+			{
+				continue;
+			}
+			data_block_number = ( (uint64_t) data_address * 8 ) / io_handle->directory_block_size;
+
+			if( ( has_data_block == 0 )
+			 || ( data_block_number != last_data_block_number ) )
+			{
+				if( libcdata_array_empty(
+				     entries_array,
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to empty entries array.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfsxfs_directory_read_data_block(
+				     io_handle,
+				     file_io_handle,
+				     inode,
+				     data_block_number,
+				     entries_array,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data block: %" PRIu64 ".",
+					 function,
+					 data_block_number );
+
+					goto on_error;
+				}
+				last_data_block_number = data_block_number;
+				has_data_block         = 1;
+			}
+			if( libcdata_array_get_number_of_entries(
+			     entries_array,
+			     &number_of_directory_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries.",
+				 function );
+
+				goto on_error;
+			}
+			for( directory_entry_index = 0;
+			     directory_entry_index < number_of_directory_entries;
+			     directory_entry_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     entries_array,
+				     directory_entry_index,
+				     (intptr_t **) &safe_directory_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve entry: %d.",
+					 function,
+					 directory_entry_index );
+
+					goto on_error;
+				}
+				if( safe_directory_entry == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing entry: %d.",
+					 function,
+					 directory_entry_index );
+
+					goto on_error;
+				}
+				if( ( (size_t) safe_directory_entry->name_size == name_size )
+				 && ( memory_compare(
+				       safe_directory_entry->name,
+				       name,
+				       name_size ) == 0 ) )
+				{
+					break;
+				}
+			}
+			if( directory_entry_index < number_of_directory_entries )
+			{
+				break;
+			}
+		}
+		if( ( entry_index < (int) number_of_entries )
+		 || ( entry_lower_index >= (int) number_of_entries ) )
+		{
+			/* Either a match was found or the name hash is not in the remaining leaf blocks
+			 */
+		}
+		else if( ( file_system_block->header->next_block_number != 0 )
+		      && ( ( file_system_block->header->signature == 0xd2ff )
+		       || ( file_system_block->header->signature == 0x3dff ) ) )
+		{
+			block_number    = file_system_block->header->next_block_number;
+			read_next_block = 1;
+		}
+		if( libfsxfs_file_system_block_free(
+		     &file_system_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file system block.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( entry_index < (int) number_of_entries )
+		 && ( directory_entry_index < number_of_directory_entries ) )
+		{
+			if( libfsxfs_directory_entry_clone(
+			     directory_entry,
+			     safe_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		else if( read_next_block != 0 )
+		{
+			if( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid recursion depth value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			recursion_depth++;
+
+			if( libfsxfs_directory_read_hash_block(
+			     io_handle,
+			     file_io_handle,
+			     inode,
+			     block_number,
+			     &file_system_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read hash block: %" PRIu64 ".",
+				 function,
+				 block_number );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			result = 0;
+		}
+	}
+	if( libcdata_array_free(
+	     &entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entries array.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	if( file_system_block != NULL )
+	{
+		libfsxfs_file_system_block_free(
+		 &file_system_block,
+		 NULL );
+	}
+	if( entries_array != NULL )
+	{
+		libcdata_array_free(
+		 &entries_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entry for an UTF-8 encoded name from a directory inode
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_get_entry_from_inode_by_utf8_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_t *directory                  = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsxfs_directory_get_entry_from_inode_by_utf8_name";
+	off64_t block_offset                             = 0;
+	int result                                       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Leaf and node directories have a hash index of their entries starting at the leaf offset
+	 */
+	if( ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 && ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_DIRECTORY_V2 ) != 0 )
+	 && ( ( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
+	  || ( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE ) ) )
+	{
+		result = libfsxfs_directory_get_block_offset(
+		          io_handle,
+		          inode,
+		          LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size,
+		          &block_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset of leaf block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		/* Names longer than 255 bytes cannot be stored in a directory entry
+		 */
+		if( utf8_string_length > 255 )
+		{
+			return( 0 );
+		}
+		result = libfsxfs_directory_get_entry_from_hash_blocks_by_name(
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          utf8_string,
+		          utf8_string_length,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry from hash blocks.",
+			 function );
+
+			goto on_error;
+		}
+		return( result );
+	}
+	if( libfsxfs_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_read_file_io_handle(
+	     directory,
+	     io_handle,
+	     file_io_handle,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_directory_get_entry_by_utf8_name(
+	          directory,
+	          utf8_string,
+	          utf8_string_length,
+	          &safe_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_directory_entry_clone(
+		     directory_entry,
+		     safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Directory needs to be freed after making a clone of directory_entry
+	 */
+	if( libfsxfs_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entry for an UTF-16 encoded name from a directory inode
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_directory_get_entry_from_inode_by_utf16_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	uint8_t name[ 256 + 4 ];
+
+	libfsxfs_directory_t *directory                  = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
+	static char *function                            = "libfsxfs_directory_get_entry_from_inode_by_utf16_name";
+	libuna_unicode_character_t unicode_character     = 0;
+	off64_t block_offset                             = 0;
+	size_t name_size                                 = 0;
+	size_t utf16_string_index                        = 0;
+	int result                                       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Leaf and node directories have a hash index of their entries starting at the leaf offset
+	 */
+	if( ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 && ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_DIRECTORY_V2 ) != 0 )
+	 && ( ( inode->fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
+	  || ( inode->fork_type == LIBFSXFS_FORK_TYPE_BTREE ) ) )
+	{
+		result = libfsxfs_directory_get_block_offset(
+		          io_handle,
+		          inode,
+		          LIBFSXFS_DIRECTORY_LEAF_OFFSET / io_handle->block_size,
+		          &block_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve offset of leaf block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		/* The name hash is calculated over the UTF-8 encoded name as stored on disk
+		 */
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				goto on_error;
+			}
+			if( libuna_unicode_character_copy_to_utf8(
+			     unicode_character,
+			     name,
+			     256 + 4,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8 name.",
+				 function );
+
+				goto on_error;
+			}
+			/* Names longer than 255 bytes cannot be stored in a directory entry
+			 */
+			if( name_size > 255 )
+			{
+				return( 0 );
+			}
+		}
+		result = libfsxfs_directory_get_entry_from_hash_blocks_by_name(
+		          io_handle,
+		          file_io_handle,
+		          inode,
+		          name,
+		          name_size,
+		          directory_entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry from hash blocks.",
+			 function );
+
+			goto on_error;
+		}
+		return( result );
+	}
+	if( libfsxfs_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_directory_read_file_io_handle(
+	     directory,
+	     io_handle,
+	     file_io_handle,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_directory_get_entry_by_utf16_name(
+	          directory,
+	          utf16_string,
+	          utf16_string_length,
+	          &safe_directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-16 name.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_directory_entry_clone(
+		     directory_entry,
+		     safe_directory_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Directory needs to be freed after making a clone of directory_entry
+	 */
+	if( libfsxfs_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libfsxfs_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
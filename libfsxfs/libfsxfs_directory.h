@@ -27,6 +27,7 @@
 
 #include "libfsxfs_block_tree.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_file_system_block.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
@@ -120,6 +121,63 @@ int libfsxfs_directory_get_entry_by_utf16_name(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error );
 
+int libfsxfs_directory_get_block_offset(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     off64_t *block_offset,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_next_data_block_number(
+     libfsxfs_io_handle_t *io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     uint64_t *next_block_number,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_data_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     libcdata_array_t *entries_array,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_read_hash_block(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     uint64_t block_number,
+     libfsxfs_file_system_block_t **file_system_block,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_entry_from_hash_blocks_by_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_entry_from_inode_by_utf8_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_directory_get_entry_from_inode_by_utf16_name(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_inode_t *inode,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,770 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_directory.h"
+#include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_iterator.h"
+#include "libfsxfs_file_entry.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+/* Creates a directory iterator
+ * Make sure the value directory_iterator is referencing, is set to NULL
+ * The directory iterator takes over management of the inode
+ * The position consists of the directory data block number in the upper 32-bits
+ * and the index of the entry within the block in the lower 32-bits
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_initialize(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_inode_t *inode,
+     uint64_t position,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                               = "libfsxfs_directory_iterator_initialize";
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = memory_allocate_structure(
+	                               libfsxfs_internal_directory_iterator_t );
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_iterator,
+	     0,
+	     sizeof( libfsxfs_internal_directory_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory iterator.",
+		 function );
+
+		memory_free(
+		 internal_directory_iterator );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_directory_iterator->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Only directories stored in directory data blocks are read one block at a time,
+	 * shortform and v1 directories are small enough or need to be read at once
+	 */
+	if( ( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	 || ( ( io_handle->feature_flags & LIBFSXFS_FEATURE_FLAG_DIRECTORY_V2 ) == 0 )
+	 || ( ( inode->fork_type != LIBFSXFS_FORK_TYPE_EXTENTS )
+	  &&  ( inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE ) ) )
+	{
+		if( libfsxfs_directory_initialize(
+		     &( internal_directory_iterator->directory ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_read_file_io_handle(
+		     internal_directory_iterator->directory,
+		     io_handle,
+		     file_io_handle,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_directory_get_number_of_entries(
+		     internal_directory_iterator->directory,
+		     &( internal_directory_iterator->number_of_entries ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			goto on_error;
+		}
+		internal_directory_iterator->block_is_read = 1;
+	}
+	internal_directory_iterator->block_number = position >> 32;
+
+	if( ( position & 0xffffffffUL ) < (uint64_t) INT_MAX )
+	{
+		internal_directory_iterator->entry_index = (int) ( position & 0xffffffffUL );
+	}
+	else
+	{
+		internal_directory_iterator->entry_index = INT_MAX;
+	}
+	if( internal_directory_iterator->directory != NULL )
+	{
+		if( ( position >> 32 ) != 0 )
+		{
+			internal_directory_iterator->block_number = 0;
+			internal_directory_iterator->entry_index  = internal_directory_iterator->number_of_entries;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_directory_iterator->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_directory_iterator->io_handle      = io_handle;
+	internal_directory_iterator->file_io_handle = file_io_handle;
+	internal_directory_iterator->file_system    = file_system;
+	internal_directory_iterator->inode          = inode;
+
+	*directory_iterator = (libfsxfs_directory_iterator_t *) internal_directory_iterator;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_iterator != NULL )
+	{
+		if( internal_directory_iterator->directory != NULL )
+		{
+			libfsxfs_directory_free(
+			 &( internal_directory_iterator->directory ),
+			 NULL );
+		}
+		if( internal_directory_iterator->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_directory_iterator->entries_array ),
+			 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+			 NULL );
+		}
+		memory_free(
+		 internal_directory_iterator );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a directory iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_close(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                               = "libfsxfs_directory_iterator_close";
+	int result                                                          = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_iterator != NULL )
+	{
+		internal_directory_iterator = (libfsxfs_internal_directory_iterator_t *) *directory_iterator;
+		*directory_iterator         = NULL;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_directory_iterator->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_directory_iterator->directory != NULL )
+		{
+			if( libfsxfs_directory_free(
+			     &( internal_directory_iterator->directory ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( internal_directory_iterator->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsxfs_inode_free(
+		     &( internal_directory_iterator->inode ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_directory_iterator );
+	}
+	return( result );
+}
+
+/* Reads the entries of the first directory data block equal to or greater than a specific block number
+ * Returns 1 if successful, 0 if there are no more directory data blocks or -1 on error
+ */
+int libfsxfs_internal_directory_iterator_read_block(
+     libfsxfs_internal_directory_iterator_t *internal_directory_iterator,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsxfs_internal_directory_iterator_read_block";
+	uint64_t next_block_number = 0;
+	int result                 = 0;
+
+	if( internal_directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_directory_iterator->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator->number_of_entries = 0;
+	internal_directory_iterator->block_is_read     = 0;
+
+	result = libfsxfs_directory_get_next_data_block_number(
+	          internal_directory_iterator->io_handle,
+	          internal_directory_iterator->inode,
+	          block_number,
+	          &next_block_number,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data block number.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		internal_directory_iterator->block_is_read = 1;
+
+		return( 0 );
+	}
+	if( libfsxfs_directory_read_data_block(
+	     internal_directory_iterator->io_handle,
+	     internal_directory_iterator->file_io_handle,
+	     internal_directory_iterator->inode,
+	     next_block_number,
+	     internal_directory_iterator->entries_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block: %" PRIu64 ".",
+		 function,
+		 next_block_number );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_directory_iterator->entries_array,
+	     &( internal_directory_iterator->number_of_entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_block_number != internal_directory_iterator->block_number )
+	{
+		internal_directory_iterator->entry_index = 0;
+	}
+	internal_directory_iterator->block_number  = next_block_number;
+	internal_directory_iterator->block_is_read = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next sub file entry
+ * Returns 1 if successful, 0 if there are no more sub file entries or -1 on error
+ */
+int libfsxfs_directory_iterator_get_next_file_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_directory_entry_t *directory_entry                         = NULL;
+	libfsxfs_directory_entry_t *safe_directory_entry                    = NULL;
+	libfsxfs_inode_t *inode                                             = NULL;
+	libfsxfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                               = "libfsxfs_directory_iterator_get_next_file_entry";
+	int result                                                          = 1;
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsxfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Read directory data blocks until one with an unread entry is found
+	 */
+	while( ( internal_directory_iterator->block_is_read == 0 )
+	    || ( internal_directory_iterator->entry_index >= internal_directory_iterator->number_of_entries ) )
+	{
+		if( internal_directory_iterator->directory != NULL )
+		{
+			result = 0;
+		}
+		else if( internal_directory_iterator->block_is_read == 0 )
+		{
+			result = libfsxfs_internal_directory_iterator_read_block(
+			          internal_directory_iterator,
+			          internal_directory_iterator->block_number,
+			          error );
+		}
+		else if( internal_directory_iterator->block_number == (uint64_t) UINT32_MAX )
+		{
+			result = 0;
+		}
+		else
+		{
+			result = libfsxfs_internal_directory_iterator_read_block(
+			          internal_directory_iterator,
+			          internal_directory_iterator->block_number + 1,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory data block.",
+			 function );
+
+			break;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		if( internal_directory_iterator->directory != NULL )
+		{
+			result = libfsxfs_directory_get_entry_by_index(
+			          internal_directory_iterator->directory,
+			          internal_directory_iterator->entry_index,
+			          &directory_entry,
+			          error );
+		}
+		else
+		{
+			result = libcdata_array_get_entry_by_index(
+			          internal_directory_iterator->entries_array,
+			          internal_directory_iterator->entry_index,
+			          (intptr_t **) &directory_entry,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry: %d.",
+			 function,
+			 internal_directory_iterator->entry_index );
+
+			result = -1;
+		}
+		else if( directory_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing directory entry: %d.",
+			 function,
+			 internal_directory_iterator->entry_index );
+
+			result = -1;
+		}
+		else if( libfsxfs_file_system_get_inode_by_number(
+		          internal_directory_iterator->file_system,
+		          internal_directory_iterator->io_handle,
+		          internal_directory_iterator->file_io_handle,
+		          directory_entry->inode_number,
+		          &inode,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve inode: %" PRIu64 ".",
+			 function,
+			 directory_entry->inode_number );
+
+			result = -1;
+		}
+		else if( libfsxfs_directory_entry_clone(
+		          &safe_directory_entry,
+		          directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone directory entry.",
+			 function );
+
+			libfsxfs_inode_free(
+			 &inode,
+			 NULL );
+
+			result = -1;
+		}
+		/* libfsxfs_file_entry_initialize takes over management of inode and safe_directory_entry
+		 */
+		else if( libfsxfs_file_entry_initialize(
+		          sub_file_entry,
+		          internal_directory_iterator->io_handle,
+		          internal_directory_iterator->file_io_handle,
+		          internal_directory_iterator->file_system,
+		          directory_entry->inode_number,
+		          inode,
+		          safe_directory_entry,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file entry.",
+			 function );
+
+			libfsxfs_inode_free(
+			 &inode,
+			 NULL );
+
+			libfsxfs_directory_entry_free(
+			 &safe_directory_entry,
+			 NULL );
+
+			result = -1;
+		}
+		else
+		{
+			internal_directory_iterator->entry_index += 1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the position of the directory iterator
+ * The position can be used to resume iterating the directory with a new iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_directory_iterator_get_position(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t *position,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_directory_iterator_t *internal_directory_iterator = NULL;
+	static char *function                                               = "libfsxfs_directory_iterator_get_position";
+
+	if( directory_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_iterator = (libfsxfs_internal_directory_iterator_t *) directory_iterator;
+
+	if( position == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid position.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*position = ( internal_directory_iterator->block_number << 32 ) | (uint32_t) internal_directory_iterator->entry_index;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_directory_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,130 @@
+/*
+ * Directory iterator functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_DIRECTORY_ITERATOR_H )
+#define _LIBFSXFS_DIRECTORY_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_directory.h"
+#include "libfsxfs_extern.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_internal_directory_iterator libfsxfs_internal_directory_iterator_t;
+
+struct libfsxfs_internal_directory_iterator
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file system
+	 */
+	libfsxfs_file_system_t *file_system;
+
+	/* The directory inode
+	 */
+	libfsxfs_inode_t *inode;
+
+	/* The directory, used for directories that are read at once
+	 */
+	libfsxfs_directory_t *directory;
+
+	/* The entries of the current directory data block
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The current directory data block number
+	 */
+	uint64_t block_number;
+
+	/* The index of the next entry in the current directory data block
+	 */
+	int entry_index;
+
+	/* The number of entries in the current directory data block
+	 */
+	int number_of_entries;
+
+	/* Value to indicate the current directory data block was read
+	 */
+	uint8_t block_is_read;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_directory_iterator_initialize(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_inode_t *inode,
+     uint64_t position,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_directory_iterator_close(
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_directory_iterator_read_block(
+     libfsxfs_internal_directory_iterator_t *internal_directory_iterator,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_directory_iterator_get_next_file_entry(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     libfsxfs_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_directory_iterator_get_position(
+     libfsxfs_directory_iterator_t *directory_iterator,
+     uint64_t *position,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_DIRECTORY_ITERATOR_H ) */
+
@@ -25,6 +25,7 @@
 
 #include "libfsxfs_attribute_values.h"
 #include "libfsxfs_attributes.h"
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_extended_attribute.h"
 #include "libfsxfs_extent.h"
 #include "libfsxfs_file_system.h"
@@ -48,6 +49,7 @@ int libfsxfs_extended_attribute_initialize(
      libfsxfs_file_system_t *file_system,
      libfsxfs_inode_t *inode,
      libfsxfs_attribute_values_t *attribute_values,
+     uint8_t flags,
      libcerror_error_t **error )
 {
 	libfsxfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
@@ -111,6 +113,7 @@ int libfsxfs_extended_attribute_initialize(
 	internal_extended_attribute->file_system      = file_system;
 	internal_extended_attribute->inode            = inode;
 	internal_extended_attribute->attribute_values = attribute_values;
+	internal_extended_attribute->flags            = flags;
 
 #if defined( HAVE_MULTI_THREAD_SUPPORT ) && !defined( HAVE_LOCAL_LIBFSXFS )
 	if( libcthreads_read_write_lock_initialize(
@@ -198,6 +201,35 @@ int libfsxfs_extended_attribute_free(
 				result = -1;
 			}
 		}
+		if( ( internal_extended_attribute->flags & LIBFSXFS_EXTENDED_ATTRIBUTE_FLAG_MANAGED_VALUES ) != 0 )
+		{
+			if( libfsxfs_attribute_values_free(
+			     &( internal_extended_attribute->attribute_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free attribute values.",
+				 function );
+
+				result = -1;
+			}
+			if( libfsxfs_inode_free(
+			     &( internal_extended_attribute->inode ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_extended_attribute );
 	}
@@ -69,6 +69,10 @@ struct libfsxfs_internal_extended_attribute
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The flags
+	 */
+	uint8_t flags;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -83,6 +87,7 @@ int libfsxfs_extended_attribute_initialize(
      libfsxfs_file_system_t *file_system,
      libfsxfs_inode_t *inode,
      libfsxfs_attribute_values_t *attribute_values,
+     uint8_t flags,
      libcerror_error_t **error );
 
 LIBFSXFS_EXTERN \
@@ -133,6 +133,85 @@ int libfsxfs_extent_free(
 	return( 1 );
 }
 
+/* Clones an extent
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_clone(
+     libfsxfs_extent_t **destination_extent,
+     libfsxfs_extent_t *source_extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_clone";
+
+	if( destination_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_extent != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination extent value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_extent == NULL )
+	{
+		*destination_extent = NULL;
+
+		return( 1 );
+	}
+	*destination_extent = memory_allocate_structure(
+	                       libfsxfs_extent_t );
+
+	if( *destination_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_extent,
+	     source_extent,
+	     sizeof( libfsxfs_extent_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination extent.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *destination_extent != NULL )
+	{
+		memory_free(
+		 *destination_extent );
+
+		*destination_extent = NULL;
+	}
+	return( -1 );
+}
+
 /* Reads the extent data
  * Returns 1 if successful or -1 on error
  */
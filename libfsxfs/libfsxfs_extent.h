@@ -61,6 +61,11 @@ int libfsxfs_extent_free(
      libfsxfs_extent_t **extent,
      libcerror_error_t **error );
 
+int libfsxfs_extent_clone(
+     libfsxfs_extent_t **destination_extent,
+     libfsxfs_extent_t *source_extent,
+     libcerror_error_t **error );
+
 int libfsxfs_extent_read_data(
      libfsxfs_extent_t *extent,
      const uint8_t *data,
@@ -0,0 +1,677 @@
+/*
+ * Extent array functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
+#include "libfsxfs_libcerror.h"
+
+/* Creates an extent array
+ * Make sure the value extent_array is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_initialize(
+     libfsxfs_extent_array_t **extent_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_initialize";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extent array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*extent_array = memory_allocate_structure(
+	                 libfsxfs_extent_array_t );
+
+	if( *extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create extent array.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *extent_array,
+	     0,
+	     sizeof( libfsxfs_extent_array_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *extent_array != NULL )
+	{
+		memory_free(
+		 *extent_array );
+
+		*extent_array = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an extent array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_free(
+     libfsxfs_extent_array_t **extent_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_free";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extent_array != NULL )
+	{
+		if( ( *extent_array )->extents != NULL )
+		{
+			memory_free(
+			 ( *extent_array )->extents );
+		}
+		memory_free(
+		 *extent_array );
+
+		*extent_array = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones an extent array
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_clone(
+     libfsxfs_extent_array_t **destination_extent_array,
+     libfsxfs_extent_array_t *source_extent_array,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_array_t *safe_extent_array = NULL;
+	static char *function                      = "libfsxfs_extent_array_clone";
+
+	if( destination_extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_extent_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination extent array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_extent_array == NULL )
+	{
+		*destination_extent_array = NULL;
+
+		return( 1 );
+	}
+	if( libfsxfs_extent_array_initialize(
+	     &safe_extent_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination extent array.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_extent_array->number_of_extents > 0 )
+	{
+		if( libfsxfs_extent_array_reserve(
+		     safe_extent_array,
+		     source_extent_array->number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize destination extent array.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_extent_array->extents,
+		     source_extent_array->extents,
+		     sizeof( libfsxfs_extent_t ) * source_extent_array->number_of_extents ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination extents.",
+			 function );
+
+			goto on_error;
+		}
+		safe_extent_array->number_of_extents = source_extent_array->number_of_extents;
+	}
+	*destination_extent_array = safe_extent_array;
+
+	return( 1 );
+
+on_error:
+	if( safe_extent_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &safe_extent_array,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Empties an extent array
+ * The allocated extents are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_empty(
+     libfsxfs_extent_array_t *extent_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_empty";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	extent_array->number_of_extents = 0;
+
+	return( 1 );
+}
+
+/* Truncates an extent array to a specific number of extents
+ * The extents after the specific number of extents are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_truncate(
+     libfsxfs_extent_array_t *extent_array,
+     int number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_truncate";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_extents < 0 )
+	 || ( number_of_extents > extent_array->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	extent_array->number_of_extents = number_of_extents;
+
+	return( 1 );
+}
+
+/* Makes sure the extent array can store a specific number of extents
+ * without having to be resized
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_reserve(
+     libfsxfs_extent_array_t *extent_array,
+     int maximum_number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *reallocation = NULL;
+	static char *function           = "libfsxfs_extent_array_reserve";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_extents < 0 )
+	 || ( (size_t) maximum_number_of_extents > ( (size_t) SSIZE_MAX / sizeof( libfsxfs_extent_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_extents <= extent_array->maximum_number_of_extents )
+	{
+		return( 1 );
+	}
+	reallocation = (libfsxfs_extent_t *) memory_reallocate(
+	                                      extent_array->extents,
+	                                      sizeof( libfsxfs_extent_t ) * maximum_number_of_extents );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize extents.",
+		 function );
+
+		return( -1 );
+	}
+	extent_array->extents                   = reallocation;
+	extent_array->maximum_number_of_extents = maximum_number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves the number of extents
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_get_number_of_extents(
+     libfsxfs_extent_array_t *extent_array,
+     int *number_of_extents,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_get_number_of_extents";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_extents = extent_array->number_of_extents;
+
+	return( 1 );
+}
+
+/* Retrieves a specific extent
+ * The extent references the storage of the extent array and remains valid
+ * until the next extent is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_get_extent_by_index(
+     libfsxfs_extent_array_t *extent_array,
+     int extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_get_extent_by_index";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( extent_index < 0 )
+	 || ( extent_index >= extent_array->number_of_extents ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	*extent = &( extent_array->extents[ extent_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the last extent
+ * The last extent is set to NULL if the extent array is empty
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_get_last_extent(
+     libfsxfs_extent_array_t *extent_array,
+     libfsxfs_extent_t **last_extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_array_get_last_extent";
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_array->number_of_extents == 0 )
+	{
+		*last_extent = NULL;
+	}
+	else
+	{
+		*last_extent = &( extent_array->extents[ extent_array->number_of_extents - 1 ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the extent that contains a specific logical block number
+ * The extents in the array are expected to be stored in ascending order of logical block number
+ * If no extent contains the logical block number, extent is set to NULL and extent_index is
+ * set to the index of the first extent after the logical block number
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_extent_array_get_extent_by_logical_block_number(
+     libfsxfs_extent_array_t *extent_array,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *safe_extent = NULL;
+	static char *function          = "libfsxfs_extent_array_get_extent_by_logical_block_number";
+	int lower_extent_index         = 0;
+	int middle_extent_index        = 0;
+	int upper_extent_index         = 0;
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	upper_extent_index = extent_array->number_of_extents;
+
+	while( lower_extent_index < upper_extent_index )
+	{
+		middle_extent_index = lower_extent_index + ( ( upper_extent_index - lower_extent_index ) / 2 );
+
+		safe_extent = &( extent_array->extents[ middle_extent_index ] );
+
+		if( logical_block_number < safe_extent->logical_block_number )
+		{
+			upper_extent_index = middle_extent_index;
+		}
+		else if( ( logical_block_number - safe_extent->logical_block_number ) >= (uint64_t) safe_extent->number_of_blocks )
+		{
+			lower_extent_index = middle_extent_index + 1;
+		}
+		else
+		{
+			*extent_index = middle_extent_index;
+			*extent       = safe_extent;
+
+			return( 1 );
+		}
+	}
+	*extent_index = lower_extent_index;
+	*extent       = NULL;
+
+	return( 0 );
+}
+
+/* Appends an extent
+ * The extent is cleared and references the storage of the extent array,
+ * it remains valid until the next extent is appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_array_append_extent(
+     libfsxfs_extent_array_t *extent_array,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *safe_extent = NULL;
+	static char *function          = "libfsxfs_extent_array_append_extent";
+	int maximum_number_of_extents  = 0;
+
+	if( extent_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent array.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_array->number_of_extents == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid extent array - number of extents value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_array->number_of_extents >= extent_array->maximum_number_of_extents )
+	{
+		/* Grow the extents geometrically to keep appending amortized constant
+		 */
+		if( extent_array->maximum_number_of_extents < LIBFSXFS_EXTENT_ARRAY_MINIMUM_NUMBER_OF_EXTENTS )
+		{
+			maximum_number_of_extents = LIBFSXFS_EXTENT_ARRAY_MINIMUM_NUMBER_OF_EXTENTS;
+		}
+		else if( extent_array->maximum_number_of_extents > ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_extents = INT_MAX;
+		}
+		else
+		{
+			maximum_number_of_extents = extent_array->maximum_number_of_extents * 2;
+		}
+		if( libfsxfs_extent_array_reserve(
+		     extent_array,
+		     maximum_number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize extent array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_extent = &( extent_array->extents[ extent_array->number_of_extents ] );
+
+	if( memory_set(
+	     safe_extent,
+	     0,
+	     sizeof( libfsxfs_extent_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear extent.",
+		 function );
+
+		return( -1 );
+	}
+	extent_array->number_of_extents += 1;
+
+	*extent = safe_extent;
+
+	return( 1 );
+}
+
@@ -0,0 +1,112 @@
+/*
+ * Extent array functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_EXTENT_ARRAY_H )
+#define _LIBFSXFS_EXTENT_ARRAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_extent.h"
+#include "libfsxfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_extent_array libfsxfs_extent_array_t;
+
+struct libfsxfs_extent_array
+{
+	/* The extents, stored contiguously in ascending order of logical block number
+	 */
+	libfsxfs_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* The number of extents that fit in the allocated extents
+	 */
+	int maximum_number_of_extents;
+};
+
+int libfsxfs_extent_array_initialize(
+     libfsxfs_extent_array_t **extent_array,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_free(
+     libfsxfs_extent_array_t **extent_array,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_clone(
+     libfsxfs_extent_array_t **destination_extent_array,
+     libfsxfs_extent_array_t *source_extent_array,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_empty(
+     libfsxfs_extent_array_t *extent_array,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_truncate(
+     libfsxfs_extent_array_t *extent_array,
+     int number_of_extents,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_reserve(
+     libfsxfs_extent_array_t *extent_array,
+     int maximum_number_of_extents,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_get_number_of_extents(
+     libfsxfs_extent_array_t *extent_array,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_get_extent_by_index(
+     libfsxfs_extent_array_t *extent_array,
+     int extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_get_last_extent(
+     libfsxfs_extent_array_t *extent_array,
+     libfsxfs_extent_t **last_extent,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_get_extent_by_logical_block_number(
+     libfsxfs_extent_array_t *extent_array,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_array_append_extent(
+     libfsxfs_extent_array_t *extent_array,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_EXTENT_ARRAY_H ) */
+
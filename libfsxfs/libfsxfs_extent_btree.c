@@ -27,11 +27,14 @@
 #include "libfsxfs_btree_block.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_extent_btree.h"
 #include "libfsxfs_extents.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 /* Creates an extent B+ tree
  * Make sure the value extent_btree is referencing, is set to NULL
@@ -91,13 +94,55 @@ int libfsxfs_extent_btree_initialize(
 		 "%s: unable to clear extent B+ tree.",
 		 function );
 
+		memory_free(
+		 *extent_btree );
+
+		*extent_btree = NULL;
+
+		return( -1 );
+	}
+	if( libfcache_cache_initialize(
+	     &( ( *extent_btree )->blocks_cache ),
+	     LIBFSXFS_MAXIMUM_CACHE_ENTRIES_EXTENT_BTREE_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blocks cache.",
+		 function );
+
+		goto on_error;
+	}
+	( *extent_btree )->number_of_references = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *extent_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
 		goto on_error;
 	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *extent_btree != NULL )
 	{
+		if( ( *extent_btree )->blocks_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *extent_btree )->blocks_cache ),
+			 NULL );
+		}
 		memory_free(
 		 *extent_btree );
 
@@ -107,13 +152,16 @@ on_error:
 }
 
 /* Frees an extent B+ tree
+ * The extent B+ tree is only freed when its last reference is freed
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_extent_btree_free(
      libfsxfs_extent_btree_t **extent_btree,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_extent_btree_free";
+	static char *function    = "libfsxfs_extent_btree_free";
+	int number_of_references = 0;
+	int result               = 1;
 
 	if( extent_btree == NULL )
 	{
@@ -128,11 +176,161 @@ int libfsxfs_extent_btree_free(
 	}
 	if( *extent_btree != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     ( *extent_btree )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		( *extent_btree )->number_of_references -= 1;
+
+		number_of_references = ( *extent_btree )->number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     ( *extent_btree )->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_references > 0 )
+		{
+			*extent_btree = NULL;
+
+			return( 1 );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *extent_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libfcache_cache_free(
+		     &( ( *extent_btree )->blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *extent_btree );
 
 		*extent_btree = NULL;
 	}
+	return( result );
+}
+
+/* Retrieves a reference to an extent B+ tree
+ * The destination extent B+ tree shares the nodes cached by the source extent B+ tree
+ * Make sure the value destination_extent_btree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_btree_get_reference(
+     libfsxfs_extent_btree_t **destination_extent_btree,
+     libfsxfs_extent_btree_t *source_extent_btree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_extent_btree_get_reference";
+
+	if( destination_extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_extent_btree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination extent B+ tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     source_extent_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	source_extent_btree->number_of_references += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     source_extent_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*destination_extent_btree = source_extent_btree;
+
 	return( 1 );
 }
 
@@ -146,17 +344,16 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
      uint64_t number_of_blocks,
      const uint8_t *data,
      size_t data_size,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_t *last_extent   = NULL;
-	libfsxfs_extent_t *sparse_extent = NULL;
-	static char *function            = "libfsxfs_extent_btree_get_extents_from_root_node";
-	uint64_t logical_block_number    = 0;
-	uint16_t level                   = 0;
-	uint16_t number_of_records       = 0;
-	int entry_index                  = 0;
+	libfsxfs_extent_t *last_extent = NULL;
+	static char *function          = "libfsxfs_extent_btree_get_extents_from_root_node";
+	uint64_t logical_block_number  = 0;
+	uint16_t level                 = 0;
+	uint16_t number_of_records     = 0;
+	int result                     = 0;
 
 	if( extent_btree == NULL )
 	{
@@ -242,17 +439,53 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
 
 		goto on_error;
 	}
-	if( libfsxfs_extent_btree_get_extents_from_branch_node(
-	     extent_btree,
-	     io_handle,
-	     file_io_handle,
-	     number_of_records,
-	     &( data[ 4 ] ),
-	     data_size - 4,
-	     extents_array,
-	     add_sparse_extents,
-	     0,
+	/* The blocks cache can be shared by multiple inodes
+	 */
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     extent_btree->read_write_lock,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	extent_btree->maximum_depth = level;
+
+	result = libfsxfs_extent_btree_get_extents_from_branch_node(
+	          extent_btree,
+	          io_handle,
+	          file_io_handle,
+	          number_of_records,
+	          &( data[ 4 ] ),
+	          data_size - 4,
+	          extent_array,
+	          add_sparse_extents,
+	          0,
+	          error );
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     extent_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -263,8 +496,8 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
 
 		goto on_error;
 	}
-	if( libfsxfs_extents_get_last_extent(
-	     extents_array,
+	if( libfsxfs_extent_array_get_last_extent(
+	     extent_array,
 	     &last_extent,
 	     error ) != 1 )
 	{
@@ -287,26 +520,9 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
 		if( ( last_extent == NULL )
 		 || ( ( last_extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 ) )
 		{
-			if( libfsxfs_extent_initialize(
-			     &sparse_extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sparse extent.",
-				 function );
-
-				goto on_error;
-			}
-			sparse_extent->logical_block_number = logical_block_number;
-			sparse_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
-
-			if( libcdata_array_append_entry(
-			     extents_array,
-			     &entry_index,
-			     (intptr_t *) sparse_extent,
+			if( libfsxfs_extent_array_append_extent(
+			     extent_array,
+			     &last_extent,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -318,8 +534,8 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
 
 				goto on_error;
 			}
-			last_extent   = sparse_extent;
-			sparse_extent = NULL;
+			last_extent->logical_block_number = logical_block_number;
+			last_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
 		}
 		last_extent->number_of_blocks += number_of_blocks - logical_block_number;
 
@@ -349,15 +565,8 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
 	return( 1 );
 
 on_error:
-	if( sparse_extent != NULL )
-	{
-		libfsxfs_extent_free(
-		 &sparse_extent,
-		 NULL );
-	}
-	libcdata_array_empty(
-	 extents_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	libfsxfs_extent_array_empty(
+	 extent_array,
 	 NULL );
 
 	return( -1 );
@@ -373,7 +582,7 @@ int libfsxfs_extent_btree_get_extents_from_branch_node(
      uint16_t number_of_records,
      const uint8_t *records_data,
      size_t records_data_size,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      int recursion_depth,
      libcerror_error_t **error )
@@ -505,7 +714,7 @@ int libfsxfs_extent_btree_get_extents_from_branch_node(
 		     io_handle,
 		     file_io_handle,
 		     sub_block_number,
-		     extents_array,
+		     extent_array,
 		     add_sparse_extents,
 		     recursion_depth + 1,
 		     error ) != 1 )
@@ -530,9 +739,8 @@ int libfsxfs_extent_btree_get_extents_from_branch_node(
 	return( 1 );
 
 on_error:
-	libcdata_array_empty(
-	 extents_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	libfsxfs_extent_array_empty(
+	 extent_array,
 	 NULL );
 
 	return( -1 );
@@ -546,7 +754,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t block_number,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      int recursion_depth,
      libcerror_error_t **error )
@@ -698,7 +906,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 	if( btree_block->header->level == 0 )
 	{
 		if( libfsxfs_extents_read_data(
-		     extents_array,
+		     extent_array,
 		     (uint32_t) btree_block->header->number_of_records,
 		     btree_block->records_data,
 		     btree_block->records_data_size,
@@ -724,7 +932,7 @@ int libfsxfs_extent_btree_get_extents_from_node(
 		     btree_block->header->number_of_records,
 		     btree_block->records_data,
 		     btree_block->records_data_size,
-		     extents_array,
+		     extent_array,
 		     add_sparse_extents,
 		     recursion_depth,
 		     error ) != 1 )
@@ -761,11 +969,620 @@ on_error:
 		 &btree_block,
 		 NULL );
 	}
-	libcdata_array_empty(
-	 extents_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	libfsxfs_extent_array_empty(
+	 extent_array,
 	 NULL );
 
 	return( -1 );
 }
 
+
+/* Retrieves an extent B+ tree node
+ * The nodes are read from the blocks cache if available, otherwise they are read
+ * from the file IO handle and stored in the blocks cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_extent_btree_get_node(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libfsxfs_btree_block_t **btree_block,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfsxfs_btree_block_t *safe_btree_block = NULL;
+	static char *function                    = "libfsxfs_extent_btree_get_node";
+	off64_t btree_block_offset               = 0;
+	uint64_t relative_block_number           = 0;
+	int allocation_group_index               = 0;
+	int compare_result                       = 0;
+	int result                               = 0;
+
+	if( extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->allocation_group_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - allocation group size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	*btree_block = NULL;
+
+	result = libfcache_cache_get_value_by_identifier(
+	          extent_btree->blocks_cache,
+	          0,
+	          (off64_t) block_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B+ tree block from cache value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( *btree_block == NULL )
+	{
+		allocation_group_index = (int) ( block_number >> io_handle->number_of_relative_block_number_bits );
+		relative_block_number  = block_number & ( ( 1 << io_handle->number_of_relative_block_number_bits ) - 1 );
+
+		btree_block_offset = ( ( (off64_t) allocation_group_index * io_handle->allocation_group_size ) + relative_block_number ) * io_handle->block_size;
+
+		if( libfsxfs_btree_block_initialize(
+		     &safe_btree_block,
+		     io_handle->block_size,
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create B+ tree block.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_btree_block_read_file_io_handle(
+		     safe_btree_block,
+		     io_handle,
+		     file_io_handle,
+		     btree_block_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_number,
+			 btree_block_offset,
+			 btree_block_offset );
+
+			goto on_error;
+		}
+		if( io_handle->format_version == 5 )
+		{
+			compare_result = memory_compare(
+			                  safe_btree_block->header->signature,
+			                  "BMA3",
+			                  4 );
+		}
+		else
+		{
+			compare_result = memory_compare(
+			                  safe_btree_block->header->signature,
+			                  "BMAP",
+			                  4 );
+		}
+		if( compare_result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported block signature.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     extent_btree->blocks_cache,
+		     0,
+		     (off64_t) block_number,
+		     0,
+		     (intptr_t *) safe_btree_block,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_btree_block_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set B+ tree block in cache.",
+			 function );
+
+			goto on_error;
+		}
+		*btree_block     = safe_btree_block;
+		safe_btree_block = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( safe_btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &safe_btree_block,
+		 NULL );
+	}
+	*btree_block = NULL;
+
+	return( -1 );
+}
+
+/* Retrieves the extent that contains a specific logical block number
+ * Only the nodes on the path from the root node to the leaf node that contains
+ * the logical block number are read. The extent values are copied into extent
+ * If no extent contains the logical block number, next_logical_block_number is
+ * set to the logical block number of the next extent or 0xffffffffffffffff
+ * if there is no next extent
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_extent_btree_get_extent_by_logical_block_number(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t logical_block_number,
+     libfsxfs_extent_t *extent,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_btree_block_t *btree_block     = NULL;
+	const uint8_t *records_data             = NULL;
+	static char *function                   = "libfsxfs_extent_btree_get_extent_by_logical_block_number";
+	size_t number_of_key_value_pairs        = 0;
+	size_t records_data_size                = 0;
+	uint64_t key_logical_block_number       = 0;
+	uint64_t safe_next_logical_block_number = 0;
+	uint64_t sub_block_number               = 0;
+	uint16_t level                          = 0;
+	uint16_t number_of_records              = 0;
+	uint16_t record_index                   = 0;
+	uint16_t lower_record_index             = 0;
+	uint16_t upper_record_index             = 0;
+	int recursion_depth                     = 0;
+	int result                              = 0;
+
+	if( extent_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_logical_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next logical block number.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 0 ] ),
+	 level );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( data[ 2 ] ),
+	 number_of_records );
+
+	if( level == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported B+ tree root node level.",
+		 function );
+
+		return( -1 );
+	}
+	records_data      = &( data[ 4 ] );
+	records_data_size = data_size - 4;
+
+	/* The logical block number of the next extent is bound by the key
+	 * of the next record in the branch nodes on the path to the leaf node
+	 */
+	safe_next_logical_block_number = (uint64_t) 0xffffffffffffffffUL;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     extent_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( level > 0 )
+	{
+		if( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_key_value_pairs = records_data_size / 16;
+
+		if( (size_t) number_of_records > number_of_key_value_pairs )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_records == 0 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint64_big_endian(
+		 records_data,
+		 key_logical_block_number );
+
+		if( logical_block_number < key_logical_block_number )
+		{
+			safe_next_logical_block_number = key_logical_block_number;
+			number_of_records              = 0;
+
+			break;
+		}
+		/* Determine the last record with a key that is less than or equal
+		 * to the logical block number
+		 */
+		lower_record_index = 0;
+		upper_record_index = number_of_records;
+
+		while( ( upper_record_index - lower_record_index ) > 1 )
+		{
+			record_index = lower_record_index + ( ( upper_record_index - lower_record_index ) / 2 );
+
+			byte_stream_copy_to_uint64_big_endian(
+			 &( records_data[ record_index * 8 ] ),
+			 key_logical_block_number );
+
+			if( logical_block_number < key_logical_block_number )
+			{
+				upper_record_index = record_index;
+			}
+			else
+			{
+				lower_record_index = record_index;
+			}
+		}
+		if( upper_record_index < number_of_records )
+		{
+			byte_stream_copy_to_uint64_big_endian(
+			 &( records_data[ upper_record_index * 8 ] ),
+			 safe_next_logical_block_number );
+		}
+		byte_stream_copy_to_uint64_big_endian(
+		 &( records_data[ ( number_of_key_value_pairs * 8 ) + ( lower_record_index * 8 ) ] ),
+		 sub_block_number );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: level: %" PRIu16 " record: %" PRIu16 " sub node block number\t: %" PRIu64 "\n",
+			 function,
+			 level,
+			 lower_record_index,
+			 sub_block_number );
+		}
+#endif
+		if( libfsxfs_extent_btree_get_node(
+		     extent_btree,
+		     io_handle,
+		     file_io_handle,
+		     sub_block_number,
+		     &btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent B+ tree node: %" PRIu64 ".",
+			 function,
+			 sub_block_number );
+
+			goto on_error;
+		}
+		if( ( btree_block == NULL )
+		 || ( btree_block->header == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing extent B+ tree node: %" PRIu64 ".",
+			 function,
+			 sub_block_number );
+
+			goto on_error;
+		}
+		if( (uint32_t) btree_block->header->level != (uint32_t) ( level - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported B+ tree node level.",
+			 function );
+
+			goto on_error;
+		}
+		level             = (uint16_t) btree_block->header->level;
+		number_of_records = (uint16_t) btree_block->header->number_of_records;
+		records_data      = btree_block->records_data;
+		records_data_size = btree_block->records_data_size;
+
+		recursion_depth++;
+	}
+	if( ( level == 0 )
+	 && ( number_of_records > 0 ) )
+	{
+		if( (size_t) number_of_records > ( records_data_size / 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of records value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Determine the last extent that starts at or before the logical block number
+		 */
+		lower_record_index = 0;
+		upper_record_index = number_of_records;
+
+		while( upper_record_index > lower_record_index )
+		{
+			record_index = lower_record_index + ( ( upper_record_index - lower_record_index ) / 2 );
+
+			if( libfsxfs_extent_read_data(
+			     extent,
+			     &( records_data[ record_index * 16 ] ),
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extent: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( logical_block_number < extent->logical_block_number )
+			{
+				upper_record_index = record_index;
+			}
+			else
+			{
+				lower_record_index = record_index + 1;
+			}
+		}
+		/* The extent after the last extent that starts at or before the logical block number
+		 */
+		if( lower_record_index < number_of_records )
+		{
+			if( libfsxfs_extent_read_data(
+			     extent,
+			     &( records_data[ lower_record_index * 16 ] ),
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extent: %" PRIu16 ".",
+				 function,
+				 lower_record_index );
+
+				goto on_error;
+			}
+			safe_next_logical_block_number = extent->logical_block_number;
+		}
+		if( lower_record_index > 0 )
+		{
+			record_index = lower_record_index - 1;
+
+			if( libfsxfs_extent_read_data(
+			     extent,
+			     &( records_data[ record_index * 16 ] ),
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extent: %" PRIu16 ".",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+			if( ( logical_block_number - extent->logical_block_number ) < (uint64_t) extent->number_of_blocks )
+			{
+				result = 1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     extent_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 0 )
+	{
+		*next_logical_block_number = safe_next_logical_block_number;
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 extent_btree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
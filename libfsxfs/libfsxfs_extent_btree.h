@@ -25,10 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_btree_block.h"
+#include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
-#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -41,6 +45,20 @@ struct libfsxfs_extent_btree
 	/* B+ tree maximum depth
 	 */
 	uint32_t maximum_depth;
+
+	/* The B+ tree blocks cache
+	 */
+	libfcache_cache_t *blocks_cache;
+
+	/* The number of references
+	 */
+	int number_of_references;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_extent_btree_initialize(
@@ -51,6 +69,11 @@ int libfsxfs_extent_btree_free(
      libfsxfs_extent_btree_t **extent_btree,
      libcerror_error_t **error );
 
+int libfsxfs_extent_btree_get_reference(
+     libfsxfs_extent_btree_t **destination_extent_btree,
+     libfsxfs_extent_btree_t *source_extent_btree,
+     libcerror_error_t **error );
+
 int libfsxfs_extent_btree_get_extents_from_root_node(
      libfsxfs_extent_btree_t *extent_btree,
      libfsxfs_io_handle_t *io_handle,
@@ -58,7 +81,7 @@ int libfsxfs_extent_btree_get_extents_from_root_node(
      uint64_t number_of_blocks,
      const uint8_t *data,
      size_t data_size,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      libcerror_error_t **error );
 
@@ -69,7 +92,7 @@ int libfsxfs_extent_btree_get_extents_from_branch_node(
      uint16_t number_of_records,
      const uint8_t *records_data,
      size_t records_data_size,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      int recursion_depth,
      libcerror_error_t **error );
@@ -79,11 +102,30 @@ int libfsxfs_extent_btree_get_extents_from_node(
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint64_t block_number,
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint8_t add_sparse_extents,
      int recursion_depth,
      libcerror_error_t **error );
 
+int libfsxfs_extent_btree_get_node(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libfsxfs_btree_block_t **btree_block,
+     libcerror_error_t **error );
+
+int libfsxfs_extent_btree_get_extent_by_logical_block_number(
+     libfsxfs_extent_btree_t *extent_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t logical_block_number,
+     libfsxfs_extent_t *extent,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
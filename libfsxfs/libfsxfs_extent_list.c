@@ -25,9 +25,9 @@
 
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_extent_list.h"
 #include "libfsxfs_extents.h"
-#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 
@@ -35,7 +35,7 @@
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_extent_list_read_data(
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint64_t number_of_blocks,
      uint64_t number_of_extents,
      const uint8_t *data,
@@ -43,14 +43,12 @@ int libfsxfs_extent_list_read_data(
      uint8_t add_sparse_extents,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_t *last_extent   = NULL;
-	libfsxfs_extent_t *sparse_extent = NULL;
-	static char *function            = "libfsxfs_extent_list_read_data";
-	uint64_t logical_block_number    = 0;
-	int entry_index                  = 0;
+	libfsxfs_extent_t *last_extent = NULL;
+	static char *function          = "libfsxfs_extent_list_read_data";
+	uint64_t logical_block_number  = 0;
 
 	if( libfsxfs_extents_read_data(
-	     extents_array,
+	     extent_array,
 	     number_of_extents,
 	     data,
 	     data_size,
@@ -66,8 +64,8 @@ int libfsxfs_extent_list_read_data(
 
 		goto on_error;
 	}
-	if( libfsxfs_extents_get_last_extent(
-	     extents_array,
+	if( libfsxfs_extent_array_get_last_extent(
+	     extent_array,
 	     &last_extent,
 	     error ) != 1 )
 	{
@@ -90,26 +88,9 @@ int libfsxfs_extent_list_read_data(
 		if( ( last_extent == NULL )
 		 || ( ( last_extent->range_flags & LIBFSXFS_EXTENT_FLAG_IS_SPARSE ) == 0 ) )
 		{
-			if( libfsxfs_extent_initialize(
-			     &sparse_extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sparse extent.",
-				 function );
-
-				goto on_error;
-			}
-			sparse_extent->logical_block_number = logical_block_number;
-			sparse_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
-
-			if( libcdata_array_append_entry(
-			     extents_array,
-			     &entry_index,
-			     (intptr_t *) sparse_extent,
+			if( libfsxfs_extent_array_append_extent(
+			     extent_array,
+			     &last_extent,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -121,8 +102,8 @@ int libfsxfs_extent_list_read_data(
 
 				goto on_error;
 			}
-			last_extent   = sparse_extent;
-			sparse_extent = NULL;
+			last_extent->logical_block_number = logical_block_number;
+			last_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
 		}
 		last_extent->number_of_blocks += number_of_blocks - logical_block_number;
 
@@ -152,15 +133,8 @@ int libfsxfs_extent_list_read_data(
 	return( 1 );
 
 on_error:
-	if( sparse_extent != NULL )
-	{
-		libfsxfs_extent_free(
-		 &sparse_extent,
-		 NULL );
-	}
-	libcdata_array_empty(
-	 extents_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
+	libfsxfs_extent_array_empty(
+	 extent_array,
 	 NULL );
 
 	return( -1 );
@@ -25,7 +25,7 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsxfs_libcdata.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_libcerror.h"
 
 #if defined( __cplusplus )
@@ -33,7 +33,7 @@ extern "C" {
 #endif
 
 int libfsxfs_extent_list_read_data(
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint64_t number_of_blocks,
      uint64_t number_of_extents,
      const uint8_t *data,
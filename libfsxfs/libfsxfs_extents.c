@@ -25,126 +25,114 @@
 
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_extents.h"
-#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 
-/* Retrieves the last extent
+/* Reads the extent list data
+ * If sparse extents are added, extents that continue both logically and
+ * physically where the previous extent ends and have the same range flags
+ * are merged into the previous extent
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_extents_get_last_extent(
-     libcdata_array_t *extents_array,
-     libfsxfs_extent_t **last_extent,
+int libfsxfs_extents_read_data(
+     libfsxfs_extent_array_t *extent_array,
+     uint64_t number_of_extents,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t add_sparse_extents,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_extents_get_last_extent";
-	int number_of_extents = 0;
+	libfsxfs_extent_t extent;
+
+	libfsxfs_extent_t *array_extent       = NULL;
+	libfsxfs_extent_t *last_extent        = NULL;
+	static char *function                 = "libfsxfs_extents_read_data";
+	size_t data_offset                    = 0;
+	uint64_t logical_block_number         = 0;
+	uint64_t extent_index                 = 0;
+	uint32_t last_extent_number_of_blocks = 0;
+	int number_of_array_extents           = 0;
 
-	if( last_extent == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid last extent.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     extents_array,
-	     &number_of_extents,
-	     error ) != 1 )
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of extents.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_extents == 0 )
-	{
-		*last_extent = NULL;
-	}
-	else if( libcdata_array_get_entry_by_index(
-	          extents_array,
-	          number_of_extents - 1,
-	          (intptr_t **) last_extent,
-	          error ) != 1 )
+	if( number_of_extents > ( (uint64_t) data_size / 16 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve extent: %d.",
-		 function,
-		 number_of_extents - 1 );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Reads the extent list data
- * Returns 1 if successful or -1 on error
- */
-int libfsxfs_extents_read_data(
-     libcdata_array_t *extents_array,
-     uint64_t number_of_extents,
-     const uint8_t *data,
-     size_t data_size,
-     uint8_t add_sparse_extents,
-     libcerror_error_t **error )
-{
-	libfsxfs_extent_t *last_extent   = NULL;
-	libfsxfs_extent_t *sparse_extent = NULL;
-	libfsxfs_extent_t *extent        = NULL;
-	static char *function            = "libfsxfs_extents_read_data";
-	size_t data_offset               = 0;
-	uint64_t logical_block_number    = 0;
-	uint64_t extent_index            = 0;
-	int entry_index                  = 0;
-
-	if( data == NULL )
+	if( libfsxfs_extent_array_get_number_of_extents(
+	     extent_array,
+	     &number_of_array_extents,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( data_size == 0 )
-	 || ( data_size > (size_t) SSIZE_MAX ) )
+	/* The extents are stored contiguously hence make sure the extent array
+	 * can store the extents without being resized for every extent
+	 */
+	if( number_of_extents > (uint64_t) ( INT_MAX - number_of_array_extents ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data size value out of bounds.",
+		 "%s: invalid number of extents value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_extents > ( (uint64_t) data_size / 16 ) )
+	if( libfsxfs_extent_array_reserve(
+	     extent_array,
+	     number_of_array_extents + (int) number_of_extents,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid number of extents value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize extent array.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfsxfs_extents_get_last_extent(
-	     extents_array,
+	if( libfsxfs_extent_array_get_last_extent(
+	     extent_array,
 	     &last_extent,
 	     error ) != 1 )
 	{
@@ -155,10 +143,12 @@ int libfsxfs_extents_read_data(
 		 "%s: unable to retrieve last extent.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( last_extent != NULL )
 	{
+		last_extent_number_of_blocks = last_extent->number_of_blocks;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -201,22 +191,8 @@ int libfsxfs_extents_read_data(
 	     extent_index < number_of_extents;
 	     extent_index++ )
 	{
-		if( libfsxfs_extent_initialize(
-		     &extent,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create extent: %" PRIu64 ".",
-			 function,
-			 extent_index );
-
-			goto on_error;
-		}
 		if( libfsxfs_extent_read_data(
-		     extent,
+		     &extent,
 		     &( data[ data_offset ] ),
 		     16,
 		     error ) != 1 )
@@ -234,29 +210,24 @@ int libfsxfs_extents_read_data(
 		data_offset += 16;
 
 		if( ( add_sparse_extents != 0 )
-		 && ( extent->logical_block_number > logical_block_number ) )
+		 && ( last_extent != NULL )
+		 && ( extent.logical_block_number == logical_block_number )
+		 && ( extent.range_flags == last_extent->range_flags )
+		 && ( extent.physical_block_number == ( last_extent->physical_block_number + last_extent->number_of_blocks ) )
+		 && ( extent.number_of_blocks <= ( UINT32_MAX - last_extent->number_of_blocks ) ) )
 		{
-			if( libfsxfs_extent_initialize(
-			     &sparse_extent,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sparse extent.",
-				 function );
+			last_extent->number_of_blocks += extent.number_of_blocks;
 
-				goto on_error;
-			}
-			sparse_extent->logical_block_number = logical_block_number;
-			sparse_extent->number_of_blocks     = extent->logical_block_number - logical_block_number;
-			sparse_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
+			logical_block_number = last_extent->logical_block_number + last_extent->number_of_blocks;
 
-			if( libcdata_array_append_entry(
-			     extents_array,
-			     &entry_index,
-			     (intptr_t *) sparse_extent,
+			continue;
+		}
+		if( ( add_sparse_extents != 0 )
+		 && ( extent.logical_block_number > logical_block_number ) )
+		{
+			if( libfsxfs_extent_array_append_extent(
+			     extent_array,
+			     &array_extent,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -268,14 +239,15 @@ int libfsxfs_extents_read_data(
 
 				goto on_error;
 			}
-			sparse_extent = NULL;
+			array_extent->logical_block_number = logical_block_number;
+			array_extent->number_of_blocks     = extent.logical_block_number - logical_block_number;
+			array_extent->range_flags          = LIBFSXFS_EXTENT_FLAG_IS_SPARSE;
 		}
-		logical_block_number = extent->logical_block_number + extent->number_of_blocks;
+		logical_block_number = extent.logical_block_number + extent.number_of_blocks;
 
-		if( libcdata_array_append_entry(
-		     extents_array,
-		     &entry_index,
-		     (intptr_t *) extent,
+		if( libfsxfs_extent_array_append_extent(
+		     extent_array,
+		     &array_extent,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -288,28 +260,43 @@ int libfsxfs_extents_read_data(
 
 			goto on_error;
 		}
-		extent = NULL;
+		if( memory_copy(
+		     array_extent,
+		     &extent,
+		     sizeof( libfsxfs_extent_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy extent: %" PRIu64 ".",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+		last_extent = array_extent;
 	}
 	return( 1 );
 
 on_error:
-	if( sparse_extent != NULL )
-	{
-		libfsxfs_extent_free(
-		 &sparse_extent,
-		 NULL );
-	}
-	if( extent != NULL )
+	/* Only remove the extents that were appended and undo a merge into
+	 * the extent that was last before reading the extent list data
+	 */
+	if( libfsxfs_extent_array_truncate(
+	     extent_array,
+	     number_of_array_extents,
+	     NULL ) == 1 )
 	{
-		libfsxfs_extent_free(
-		 &extent,
-		 NULL );
+		if( ( libfsxfs_extent_array_get_last_extent(
+		       extent_array,
+		       &last_extent,
+		       NULL ) == 1 )
+		 && ( last_extent != NULL ) )
+		{
+			last_extent->number_of_blocks = last_extent_number_of_blocks;
+		}
 	}
-	libcdata_array_empty(
-	 extents_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
-	 NULL );
-
 	return( -1 );
 }
 
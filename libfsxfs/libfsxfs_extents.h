@@ -25,21 +25,15 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsxfs_extent.h"
-#include "libfsxfs_libcdata.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-int libfsxfs_extents_get_last_extent(
-     libcdata_array_t *extents_array,
-     libfsxfs_extent_t **last_extent,
-     libcerror_error_t **error );
-
 int libfsxfs_extents_read_data(
-     libcdata_array_t *extents_array,
+     libfsxfs_extent_array_t *extent_array,
      uint64_t number_of_extents,
      const uint8_t *data,
      size_t data_size,
@@ -28,6 +28,7 @@
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_iterator.h"
 #include "libfsxfs_extended_attribute.h"
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_inode.h"
@@ -121,6 +122,9 @@ int libfsxfs_file_entry_initialize(
 
 		return( -1 );
 	}
+	/* The data stream is created on demand, so that file entries that
+	 * are only used to retrieve metadata do not need to map the data
+	 */
 	if( ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_REGULAR_FILE )
 	 || ( ( inode->file_mode & 0xf000 ) == LIBFSXFS_FILE_TYPE_SYMBOLIC_LINK ) )
 	{
@@ -138,22 +142,6 @@ int libfsxfs_file_entry_initialize(
 
 			goto on_error;
 		}
-		if( libfsxfs_data_stream_initialize(
-		     &( internal_file_entry->data_stream ),
-		     io_handle,
-		     inode,
-		     internal_file_entry->data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data stream.",
-			 function );
-
-			goto on_error;
-		}
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
@@ -280,33 +268,34 @@ int libfsxfs_file_entry_free(
 				result = -1;
 			}
 		}
-		if( internal_file_entry->directory != NULL )
+		if( internal_file_entry->looked_up_attributes_array != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &( internal_file_entry->directory ),
+			if( libcdata_array_free(
+			     &( internal_file_entry->looked_up_attributes_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_attribute_values_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free looked up attributes array.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( internal_file_entry->data_stream != NULL )
+		if( internal_file_entry->directory != NULL )
 		{
-			if( libfdata_stream_free(
-			     &( internal_file_entry->data_stream ),
+			if( libfsxfs_directory_free(
+			     &( internal_file_entry->directory ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data stream.",
+				 "%s: unable to free directory.",
 				 function );
 
 				result = -1;
@@ -483,13 +472,14 @@ int libfsxfs_internal_file_entry_get_symbolic_link_data(
 		}
 		internal_file_entry->symbolic_link_data_size = (size_t) internal_file_entry->data_size;
 
-		read_count = libfdata_stream_read_buffer_at_offset(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
+		read_count = libfsxfs_data_stream_read_buffer_at_offset(
+		              internal_file_entry->io_handle,
+		              internal_file_entry->file_io_handle,
+		              internal_file_entry->inode,
+		              internal_file_entry->data_size,
 		              internal_file_entry->symbolic_link_data,
 		              (size_t) internal_file_entry->data_size,
 		              0,
-		              0,
 		              error );
 
 		if( read_count != (ssize_t) internal_file_entry->data_size )
@@ -2319,6 +2309,7 @@ int libfsxfs_file_entry_get_extended_attribute_by_index(
 			     internal_file_entry->file_system,
 			     internal_file_entry->inode,
 			     attribute_values,
+			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -2360,9 +2351,11 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
      libfsxfs_attribute_values_t **attribute_values,
      libcerror_error_t **error )
 {
+	libcdata_array_t *attributes_array                 = NULL;
 	libfsxfs_attribute_values_t *safe_attribute_values = NULL;
 	static char *function                              = "libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name";
 	int attribute_index                                = 0;
+	int entry_index                                    = 0;
 	int number_of_attributes                           = 0;
 	int result                                         = 0;
 
@@ -2377,7 +2370,46 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
 
 		return( -1 );
 	}
-	if( internal_file_entry->extended_attributes_array == NULL )
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->extended_attributes_array != NULL )
+	{
+		attributes_array = internal_file_entry->extended_attributes_array;
+	}
+	else if( internal_file_entry->inode->attributes_extents_array != NULL )
+	{
+		/* Leaf and node attributes are looked up by their name hash, so that only
+		 * the attributes blocks that can contain the name are read
+		 */
+		if( internal_file_entry->looked_up_attributes_array == NULL )
+		{
+			if( libcdata_array_initialize(
+			     &( internal_file_entry->looked_up_attributes_array ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create looked up attributes array.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		attributes_array = internal_file_entry->looked_up_attributes_array;
+	}
+	else
 	{
 		if( libfsxfs_internal_file_entry_get_extended_attributes(
 		     internal_file_entry,
@@ -2392,9 +2424,10 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
 
 			return( -1 );
 		}
+		attributes_array = internal_file_entry->extended_attributes_array;
 	}
 	if( libcdata_array_get_number_of_entries(
-	     internal_file_entry->extended_attributes_array,
+	     attributes_array,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -2402,7 +2435,7 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 "%s: unable to retrieve number of entries from attributes array.",
 		 function );
 
 		return( -1 );
@@ -2412,7 +2445,7 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
 	     attribute_index++ )
 	{
 		if( libcdata_array_get_entry_by_index(
-		     internal_file_entry->extended_attributes_array,
+		     attributes_array,
 		     attribute_index,
 		     (intptr_t **) &safe_attribute_values,
 		     error ) != 1 )
@@ -2452,7 +2485,61 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf8_name(
 			return( 1 );
 		}
 	}
-	return( 0 );
+	if( attributes_array != internal_file_entry->looked_up_attributes_array )
+	{
+		return( 0 );
+	}
+	safe_attribute_values = NULL;
+
+	result = libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name(
+	          internal_file_entry->io_handle,
+	          internal_file_entry->file_io_handle,
+	          internal_file_entry->inode,
+	          utf8_string,
+	          utf8_string_length,
+	          &safe_attribute_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values by UTF-8 name from inode.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_append_entry(
+		     internal_file_entry->looked_up_attributes_array,
+		     &entry_index,
+		     (intptr_t *) safe_attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute values to looked up attributes array.",
+			 function );
+
+			goto on_error;
+		}
+		*attribute_values = safe_attribute_values;
+	}
+	return( result );
+
+on_error:
+	if( safe_attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &safe_attribute_values,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the attribute values for an UTF-16 encoded name
@@ -2465,9 +2552,11 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
      libfsxfs_attribute_values_t **attribute_values,
      libcerror_error_t **error )
 {
+	libcdata_array_t *attributes_array                 = NULL;
 	libfsxfs_attribute_values_t *safe_attribute_values = NULL;
 	static char *function                              = "libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name";
 	int attribute_index                                = 0;
+	int entry_index                                    = 0;
 	int number_of_attributes                           = 0;
 	int result                                         = 0;
 
@@ -2482,7 +2571,46 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
 
 		return( -1 );
 	}
-	if( internal_file_entry->extended_attributes_array == NULL )
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file_entry->extended_attributes_array != NULL )
+	{
+		attributes_array = internal_file_entry->extended_attributes_array;
+	}
+	else if( internal_file_entry->inode->attributes_extents_array != NULL )
+	{
+		/* Leaf and node attributes are looked up by their name hash, so that only
+		 * the attributes blocks that can contain the name are read
+		 */
+		if( internal_file_entry->looked_up_attributes_array == NULL )
+		{
+			if( libcdata_array_initialize(
+			     &( internal_file_entry->looked_up_attributes_array ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create looked up attributes array.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		attributes_array = internal_file_entry->looked_up_attributes_array;
+	}
+	else
 	{
 		if( libfsxfs_internal_file_entry_get_extended_attributes(
 		     internal_file_entry,
@@ -2497,9 +2625,10 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
 
 			return( -1 );
 		}
+		attributes_array = internal_file_entry->extended_attributes_array;
 	}
 	if( libcdata_array_get_number_of_entries(
-	     internal_file_entry->extended_attributes_array,
+	     attributes_array,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -2507,7 +2636,7 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from extended attributes array.",
+		 "%s: unable to retrieve number of entries from attributes array.",
 		 function );
 
 		return( -1 );
@@ -2517,7 +2646,7 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
 	     attribute_index++ )
 	{
 		if( libcdata_array_get_entry_by_index(
-		     internal_file_entry->extended_attributes_array,
+		     attributes_array,
 		     attribute_index,
 		     (intptr_t **) &safe_attribute_values,
 		     error ) != 1 )
@@ -2557,7 +2686,61 @@ int libfsxfs_internal_file_entry_get_attribute_values_by_utf16_name(
 			return( 1 );
 		}
 	}
-	return( 0 );
+	if( attributes_array != internal_file_entry->looked_up_attributes_array )
+	{
+		return( 0 );
+	}
+	safe_attribute_values = NULL;
+
+	result = libfsxfs_attributes_get_attribute_values_from_inode_by_utf16_name(
+	          internal_file_entry->io_handle,
+	          internal_file_entry->file_io_handle,
+	          internal_file_entry->inode,
+	          utf16_string,
+	          utf16_string_length,
+	          &safe_attribute_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute values by UTF-16 name from inode.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_append_entry(
+		     internal_file_entry->looked_up_attributes_array,
+		     &entry_index,
+		     (intptr_t *) safe_attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute values to looked up attributes array.",
+			 function );
+
+			goto on_error;
+		}
+		*attribute_values = safe_attribute_values;
+	}
+	return( result );
+
+on_error:
+	if( safe_attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &safe_attribute_values,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Determines if there is an extended attribute for an UTF-8 encoded name
@@ -2808,6 +2991,7 @@ int libfsxfs_file_entry_get_extended_attribute_by_utf8_name(
 		     internal_file_entry->file_system,
 		     internal_file_entry->inode,
 		     attribute_values,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -2930,6 +3114,7 @@ int libfsxfs_file_entry_get_extended_attribute_by_utf16_name(
 		     internal_file_entry->file_system,
 		     internal_file_entry->inode,
 		     attribute_values,
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3502,18 +3687,20 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
 	return( result );
 }
 
-/* Reads data at the current offset
- * Returns the number of bytes read or -1 on error
+/* Opens a directory iterator for the sub file entries
+ * The position is either 0 or a value previously retrieved with libfsxfs_directory_iterator_get_position
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer(
-         libfsxfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfsxfs_file_entry_open_directory_iterator(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t position,
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error )
 {
+	libfsxfs_inode_t *inode                             = NULL;
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer";
-	ssize_t read_count                                  = 0;
+	static char *function                               = "libfsxfs_file_entry_open_directory_iterator";
+	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -3528,30 +3715,30 @@ ssize_t libfsxfs_file_entry_read_buffer(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
-	if( internal_file_entry->inode == NULL )
+	if( directory_iterator == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory iterator.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	if( *directory_iterator != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory iterator value already set.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3559,33 +3746,53 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
-	              error );
+	if( libfsxfs_inode_clone(
+	     &inode,
+	     internal_file_entry->inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone inode: %" PRIu64 ".",
+		 function,
+		 internal_file_entry->inode_number );
 
-	if( read_count < 0 )
+		result = -1;
+	}
+	/* libfsxfs_directory_iterator_initialize takes over management of inode
+	 */
+	else if( libfsxfs_directory_iterator_initialize(
+	          directory_iterator,
+	          internal_file_entry->io_handle,
+	          internal_file_entry->file_io_handle,
+	          internal_file_entry->file_system,
+	          inode,
+	          position,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory iterator.",
 		 function );
 
-		read_count = -1;
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+
+		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3593,30 +3800,36 @@ ssize_t libfsxfs_file_entry_read_buffer(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libfsxfs_directory_iterator_close(
+		 directory_iterator,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
 /* Reads data at a specific offset
+ * The data is read using positional reads, which read data that is stored
+ * contiguously in multiple extents at once directly into the buffer
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libfsxfs_file_entry_read_buffer_at_offset(
-         libfsxfs_file_entry_t *file_entry,
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
          void *buffer,
          size_t buffer_size,
          off64_t offset,
          libcerror_error_t **error )
 {
-	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                  = 0;
+	static char *function = "libfsxfs_internal_file_entry_read_buffer_at_offset";
+	ssize_t read_count    = 0;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3627,24 +3840,77 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+	read_count = libfsxfs_data_stream_read_buffer_at_offset(
+	              internal_file_entry->io_handle,
+	              file_io_handle,
+	              internal_file_entry->inode,
+	              internal_file_entry->data_size,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              error );
 
-	if( internal_file_entry->inode == NULL )
+	if( read_count < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file entry - missing inode.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
 		return( -1 );
 	}
-	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	internal_file_entry->current_offset = offset + read_count;
+
+	return( read_count );
+}
+
+/* Reads data at the current offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
 		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
 		 function );
@@ -3666,26 +3932,193 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	read_count = libfdata_stream_read_buffer_at_offset(
-	              internal_file_entry->data_stream,
-	              (intptr_t *) internal_file_entry->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              offset,
-	              0,
-	              error );
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     internal_file_entry->file_system,
+	     internal_file_entry->file_io_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
 
-	if( read_count < 0 )
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+		              internal_file_entry,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              internal_file_entry->current_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data stream.",
+			 function );
+
+			read_count = -1;
+		}
+		if( libfsxfs_file_system_release_file_io_handle(
+		     internal_file_entry->file_system,
+		     internal_file_entry->file_io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from data stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_read_buffer_at_offset(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     internal_file_entry->file_system,
+	     internal_file_entry->file_io_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
 		 function );
 
 		read_count = -1;
 	}
+	else
+	{
+		read_count = libfsxfs_internal_file_entry_read_buffer_at_offset(
+		              internal_file_entry,
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from data stream.",
+			 function );
+
+			read_count = -1;
+		}
+		if( libfsxfs_file_system_release_file_io_handle(
+		     internal_file_entry->file_system,
+		     internal_file_entry->file_io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			read_count = -1;
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -3704,6 +4137,148 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Reads data at a specific offset without changing the current offset
+ * The data is read directly from the extents of the inode at a specific offset of
+ * the file IO handle. Since no state is shared between reads, multiple threads can
+ * read different ranges of the same file entry concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsxfs_file_entry_pread_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_pread_buffer";
+	ssize_t read_count                                  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+	if( internal_file_entry->inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file entry - missing inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file_entry->inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_REGULAR_FILE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid file entry - invalid inode - unsupported file mode not a regular file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     internal_file_entry->file_system,
+	     internal_file_entry->file_io_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libfsxfs_data_stream_read_buffer_at_offset(
+		              internal_file_entry->io_handle,
+		              file_io_handle,
+		              internal_file_entry->inode,
+		              internal_file_entry->data_size,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			read_count = -1;
+		}
+		if( libfsxfs_file_system_release_file_io_handle(
+		     internal_file_entry->file_system,
+		     internal_file_entry->file_io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			read_count = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
 /* Seeks a certain offset in the data
  * Returns the offset if seek is successful or -1 on error
  */
@@ -3751,6 +4326,19 @@ off64_t libfsxfs_file_entry_seek_offset(
 
 		return( -1 );
 	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
@@ -3766,23 +4354,29 @@ off64_t libfsxfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfdata_stream_seek_offset(
-	          internal_file_entry->data_stream,
-	          offset,
-	          whence,
-	          error );
-
-	if( offset == -1 )
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_file_entry->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_file_entry->data_size;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset in data stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		offset = -1;
 	}
+	else
+	{
+		internal_file_entry->current_offset = offset;
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
@@ -3811,7 +4405,6 @@ int libfsxfs_file_entry_get_offset(
 {
 	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
 	static char *function                               = "libfsxfs_file_entry_get_offset";
-	int result                                          = 1;
 
 	if( file_entry == NULL )
 	{
@@ -3826,6 +4419,18 @@ int libfsxfs_file_entry_get_offset(
 	}
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+
 	if( internal_file_entry->inode == NULL )
 	{
 		libcerror_error_set(
@@ -3863,20 +4468,8 @@ int libfsxfs_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	if( libfdata_stream_get_offset(
-	     internal_file_entry->data_stream,
-	     offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve offset from data stream.",
-		 function );
+	*offset = internal_file_entry->current_offset;
 
-		result = -1;
-	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
@@ -3892,7 +4485,7 @@ int libfsxfs_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
 /* Retrieves the size of the data
@@ -3991,7 +4584,7 @@ int libfsxfs_file_entry_get_number_of_extents(
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3999,16 +4592,33 @@ int libfsxfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_number_of_data_extents(
+	/* The data extents are read on demand if they are stored in a B+ tree
+	 */
+	if( libfsxfs_inode_read_data_extents(
 	     internal_file_entry->inode,
-	     number_of_extents,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_number_of_data_extents(
+	          internal_file_entry->inode,
+	          number_of_extents,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4020,7 +4630,7 @@ int libfsxfs_file_entry_get_number_of_extents(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4028,7 +4638,7 @@ int libfsxfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -4067,7 +4677,7 @@ int libfsxfs_file_entry_get_extent_by_index(
 	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
 
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4075,17 +4685,34 @@ int libfsxfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfsxfs_inode_get_data_extent_by_index(
+	/* The data extents are read on demand if they are stored in a B+ tree
+	 */
+	if( libfsxfs_inode_read_data_extents(
 	     internal_file_entry->inode,
-	     extent_index,
-	     &extent,
+	     internal_file_entry->io_handle,
+	     internal_file_entry->file_io_handle,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data extents.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsxfs_inode_get_data_extent_by_index(
+	          internal_file_entry->inode,
+	          extent_index,
+	          &extent,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4119,6 +4746,133 @@ int libfsxfs_file_entry_get_extent_by_index(
 		}
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Maps the start of a logical data range onto a physical range in the volume
+ * The mapped range is the largest range that starts at the offset, does not
+ * exceed the size and is stored contiguously in the volume. To map the whole
+ * logical range call this function repeatedly with the offset advanced by the
+ * mapped size. Sparse and unwritten ranges have LIBFSXFS_EXTENT_FLAG_IS_SPARSE
+ * set and inline data LIBFSXFS_EXTENT_FLAG_IS_INLINE, in both cases the physical
+ * offset is 0
+ * Returns 1 if successful, 0 if the offset is beyond the end of the data or -1 on error
+ */
+int libfsxfs_file_entry_map_range(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t offset,
+     size64_t size,
+     off64_t *physical_offset,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                    = NULL;
+	libfsxfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                               = "libfsxfs_file_entry_map_range";
+	int result                                          = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsxfs_internal_file_entry_t *) file_entry;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     internal_file_entry->file_system,
+	     internal_file_entry->file_io_handle,
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_data_stream_map_range(
+		          internal_file_entry->io_handle,
+		          file_io_handle,
+		          internal_file_entry->inode,
+		          internal_file_entry->data_size,
+		          offset,
+		          size,
+		          physical_offset,
+		          mapped_size,
+		          range_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to map range at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+		}
+		if( libfsxfs_file_system_release_file_io_handle(
+		     internal_file_entry->file_system,
+		     internal_file_entry->file_io_handle,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
@@ -28,6 +28,7 @@
 #include "libfsxfs_attribute_values.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_directory_iterator.h"
 #include "libfsxfs_extern.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
@@ -74,6 +75,10 @@ struct libfsxfs_internal_file_entry
 	 */
 	libcdata_array_t *extended_attributes_array;
 
+	/* The extended attributes looked up by name, before all extended attributes were read
+	 */
+	libcdata_array_t *looked_up_attributes_array;
+
 	/* The directory
 	 */
 	libfsxfs_directory_t *directory;
@@ -82,9 +87,9 @@ struct libfsxfs_internal_file_entry
 	 */
 	size64_t data_size;
 
-	/* The data stream
+	/* The current offset
 	 */
-	libfdata_stream_t *data_stream;
+	off64_t current_offset;
 
 	/* The symbolic link data
 	 */
@@ -333,6 +338,21 @@ int libfsxfs_file_entry_get_sub_file_entry_by_utf16_name(
      libfsxfs_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_open_directory_iterator(
+     libfsxfs_file_entry_t *file_entry,
+     uint64_t position,
+     libfsxfs_directory_iterator_t **directory_iterator,
+     libcerror_error_t **error );
+
+ssize_t libfsxfs_internal_file_entry_read_buffer_at_offset(
+         libfsxfs_internal_file_entry_t *internal_file_entry,
+         libbfio_handle_t *file_io_handle,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 ssize_t libfsxfs_file_entry_read_buffer(
          libfsxfs_file_entry_t *file_entry,
@@ -348,6 +368,14 @@ ssize_t libfsxfs_file_entry_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+ssize_t libfsxfs_file_entry_pread_buffer(
+         libfsxfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 off64_t libfsxfs_file_entry_seek_offset(
          libfsxfs_file_entry_t *file_entry,
@@ -382,6 +410,16 @@ int libfsxfs_file_entry_get_extent_by_index(
      uint32_t *extent_flags,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_file_entry_map_range(
+     libfsxfs_file_entry_t *file_entry,
+     off64_t offset,
+     size64_t size,
+     off64_t *physical_offset,
+     size64_t *mapped_size,
+     uint32_t *range_flags,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
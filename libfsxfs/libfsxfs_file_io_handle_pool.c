@@ -0,0 +1,680 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_file_io_handle_pool.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+/* Creates a file IO handle pool
+ * The file IO handles of the pool are cloned from file_io_handle on demand
+ * Make sure the value file_io_handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_initialize(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_io_handle_pool_initialize";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_file_io_handles <= 0 )
+	 || ( maximum_number_of_file_io_handles > LIBFSXFS_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle_pool = memory_allocate_structure(
+	                        libfsxfs_file_io_handle_pool_t );
+
+	if( *file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle_pool,
+	     0,
+	     sizeof( libfsxfs_file_io_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle pool.",
+		 function );
+
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+
+		return( -1 );
+	}
+	( *file_io_handle_pool )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                                   sizeof( libbfio_handle_t * ) * maximum_number_of_file_io_handles );
+
+	if( ( *file_io_handle_pool )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_handle_pool )->file_io_handles_opened_in_pool = (uint8_t *) memory_allocate(
+	                                                                        sizeof( uint8_t ) * maximum_number_of_file_io_handles );
+
+	if( ( *file_io_handle_pool )->file_io_handles_opened_in_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles opened in pool.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_io_handle_pool )->available_file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                                             sizeof( libbfio_handle_t * ) * maximum_number_of_file_io_handles );
+
+	if( ( *file_io_handle_pool )->available_file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create available file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *file_io_handle_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *file_io_handle_pool )->file_io_handle_released_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle released condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *file_io_handle_pool )->file_io_handle                    = file_io_handle;
+	( *file_io_handle_pool )->maximum_number_of_file_io_handles = maximum_number_of_file_io_handles;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_handle_pool != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( ( *file_io_handle_pool )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *file_io_handle_pool )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *file_io_handle_pool )->available_file_io_handles != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle_pool )->available_file_io_handles );
+		}
+		if( ( *file_io_handle_pool )->file_io_handles_opened_in_pool != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle_pool )->file_io_handles_opened_in_pool );
+		}
+		if( ( *file_io_handle_pool )->file_io_handles != NULL )
+		{
+			memory_free(
+			 ( *file_io_handle_pool )->file_io_handles );
+		}
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file IO handle pool
+ * The file IO handles of the pool should no longer be in use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_free(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_file_io_handle_pool_free";
+	int file_io_handle_index = 0;
+	int result               = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *file_io_handle_pool )->file_io_handle_released_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle released condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *file_io_handle_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		for( file_io_handle_index = 0;
+		     file_io_handle_index < ( *file_io_handle_pool )->number_of_file_io_handles;
+		     file_io_handle_index++ )
+		{
+			if( ( *file_io_handle_pool )->file_io_handles_opened_in_pool[ file_io_handle_index ] != 0 )
+			{
+				if( libbfio_handle_close(
+				     ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ],
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle: %d.",
+					 function,
+					 file_io_handle_index );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_free(
+			     &( ( *file_io_handle_pool )->file_io_handles[ file_io_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle: %d.",
+				 function,
+				 file_io_handle_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 ( *file_io_handle_pool )->available_file_io_handles );
+
+		memory_free(
+		 ( *file_io_handle_pool )->file_io_handles_opened_in_pool );
+
+		memory_free(
+		 ( *file_io_handle_pool )->file_io_handles );
+
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( result );
+}
+
+/* Clones the file IO handle and adds the clone to the pool
+ * This function should be called with the mutex grabbed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_clone_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *safe_file_io_handle = NULL;
+	static char *function                 = "libfsxfs_file_io_handle_pool_clone_file_io_handle";
+	uint8_t file_io_handle_opened_in_pool = 0;
+	int result                            = 0;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle_pool->number_of_file_io_handles >= file_io_handle_pool->maximum_number_of_file_io_handles )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO handle pool - number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &safe_file_io_handle,
+	     file_io_handle_pool->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          safe_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     safe_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_pool = 1;
+	}
+	file_io_handle_pool->file_io_handles[ file_io_handle_pool->number_of_file_io_handles ]                = safe_file_io_handle;
+	file_io_handle_pool->file_io_handles_opened_in_pool[ file_io_handle_pool->number_of_file_io_handles ] = file_io_handle_opened_in_pool;
+
+	file_io_handle_pool->number_of_file_io_handles += 1;
+
+	*file_io_handle = safe_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( safe_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &safe_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Grabs a file IO handle from the pool for exclusive use
+ * A file IO handle is cloned if none is available and the maximum number of
+ * file IO handles has not been reached, otherwise the function waits until
+ * another thread releases a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_grab_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *safe_file_io_handle = NULL;
+	static char *function                 = "libfsxfs_file_io_handle_pool_grab_file_io_handle";
+	int result                            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_io_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( file_io_handle_pool->number_of_available_file_io_handles == 0 )
+	{
+		if( file_io_handle_pool->number_of_file_io_handles < file_io_handle_pool->maximum_number_of_file_io_handles )
+		{
+			if( libfsxfs_file_io_handle_pool_clone_file_io_handle(
+			     file_io_handle_pool,
+			     &safe_file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to clone file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			break;
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_wait(
+		     file_io_handle_pool->file_io_handle_released_condition,
+		     file_io_handle_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for file IO handle released condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+#else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: no file IO handle available.",
+		 function );
+
+		result = -1;
+
+		break;
+#endif
+	}
+	if( ( result == 1 )
+	 && ( safe_file_io_handle == NULL ) )
+	{
+		file_io_handle_pool->number_of_available_file_io_handles -= 1;
+
+		safe_file_io_handle = file_io_handle_pool->available_file_io_handles[ file_io_handle_pool->number_of_available_file_io_handles ];
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_io_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*file_io_handle = safe_file_io_handle;
+	}
+	return( result );
+}
+
+/* Releases a file IO handle that was grabbed from the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_io_handle_pool_release_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_io_handle_pool_release_file_io_handle";
+	int result            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     file_io_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( file_io_handle_pool->number_of_available_file_io_handles >= file_io_handle_pool->number_of_file_io_handles )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file IO handle pool - number of available file IO handles value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		file_io_handle_pool->available_file_io_handles[ file_io_handle_pool->number_of_available_file_io_handles ] = file_io_handle;
+
+		file_io_handle_pool->number_of_available_file_io_handles += 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_signal(
+		     file_io_handle_pool->file_io_handle_released_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal file IO handle released condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     file_io_handle_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,109 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_FILE_IO_HANDLE_POOL_H )
+#define _LIBFSXFS_FILE_IO_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_file_io_handle_pool libfsxfs_file_io_handle_pool_t;
+
+struct libfsxfs_file_io_handle_pool
+{
+	/* The file IO handle that is cloned
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The cloned file IO handles
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* Values to indicate if the cloned file IO handles were opened by the pool
+	 */
+	uint8_t *file_io_handles_opened_in_pool;
+
+	/* The number of cloned file IO handles
+	 */
+	int number_of_file_io_handles;
+
+	/* The maximum number of cloned file IO handles
+	 */
+	int maximum_number_of_file_io_handles;
+
+	/* The cloned file IO handles that are not in use
+	 */
+	libbfio_handle_t **available_file_io_handles;
+
+	/* The number of cloned file IO handles that are not in use
+	 */
+	int number_of_available_file_io_handles;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when a file IO handle is released
+	 */
+	libcthreads_condition_t *file_io_handle_released_condition;
+#endif
+};
+
+int libfsxfs_file_io_handle_pool_initialize(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_free(
+     libfsxfs_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_clone_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_grab_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_file_io_handle_pool_release_file_io_handle(
+     libfsxfs_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_FILE_IO_HANDLE_POOL_H ) */
+
@@ -23,18 +23,23 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_cache_shard.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_directory.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_file_io_handle_pool.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_btree_record.h"
 #include "libfsxfs_inode_information.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
-#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_name_hash.h"
 
 /* Creates a file system
  * Make sure the value file_system is referencing, is set to NULL
@@ -46,6 +51,7 @@ int libfsxfs_file_system_initialize(
      libcerror_error_t **error )
 {
 	static char *function = "libfsxfs_file_system_initialize";
+	int shard_index       = 0;
 
 	if( file_system == NULL )
 	{
@@ -115,21 +121,41 @@ int libfsxfs_file_system_initialize(
 
 		goto on_error;
 	}
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_initialize(
-	     &( ( *file_system )->read_write_lock ),
-	     error ) != 1 )
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+	     shard_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
-		 function );
+		if( libfsxfs_cache_shard_initialize(
+		     &( ( *file_system )->inodes_cache_shards[ shard_index ] ),
+		     LIBFSXFS_MAXIMUM_CACHE_ENTRIES_INODES / LIBFSXFS_NUMBER_OF_CACHE_SHARDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inodes cache shard: %d.",
+			 function,
+			 shard_index );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libfsxfs_cache_shard_initialize(
+		     &( ( *file_system )->directory_entries_cache_shards[ shard_index ] ),
+		     LIBFSXFS_MAXIMUM_CACHE_ENTRIES_DIRECTORY_ENTRIES / LIBFSXFS_NUMBER_OF_CACHE_SHARDS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create directory entries cache shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
 	}
-#endif
 	( *file_system )->root_directory_inode_number = root_directory_inode_number;
 
 	return( 1 );
@@ -137,6 +163,23 @@ int libfsxfs_file_system_initialize(
 on_error:
 	if( *file_system != NULL )
 	{
+		for( shard_index = 0;
+		     shard_index < LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+		     shard_index++ )
+		{
+			if( ( *file_system )->directory_entries_cache_shards[ shard_index ] != NULL )
+			{
+				libfsxfs_cache_shard_free(
+				 &( ( *file_system )->directory_entries_cache_shards[ shard_index ] ),
+				 NULL );
+			}
+			if( ( *file_system )->inodes_cache_shards[ shard_index ] != NULL )
+			{
+				libfsxfs_cache_shard_free(
+				 &( ( *file_system )->inodes_cache_shards[ shard_index ] ),
+				 NULL );
+			}
+		}
 		if( ( *file_system )->inode_btree != NULL )
 		{
 			libfsxfs_inode_btree_free(
@@ -160,6 +203,13 @@ int libfsxfs_file_system_free(
 {
 	static char *function = "libfsxfs_file_system_free";
 	int result            = 1;
+	int shard_index       = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+#endif
 
 	if( file_system == NULL )
 	{
@@ -174,21 +224,86 @@ int libfsxfs_file_system_free(
 	}
 	if( *file_system != NULL )
 	{
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-		if( libcthreads_read_write_lock_free(
-		     &( ( *file_system )->read_write_lock ),
-		     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free read/write lock.",
-			 function );
-
-			result = -1;
+			if( libfsxfs_file_system_get_inodes_cache_statistics(
+			     *file_system,
+			     &number_of_hits,
+			     &number_of_misses,
+			     &number_of_evictions,
+			     NULL ) == 1 )
+			{
+				libcnotify_printf(
+				 "%s: inodes cache hits: %" PRIu64 ", misses: %" PRIu64 ", evictions: %" PRIu64 "\n",
+				 function,
+				 number_of_hits,
+				 number_of_misses,
+				 number_of_evictions );
+			}
+			if( libfsxfs_file_system_get_directory_entries_cache_statistics(
+			     *file_system,
+			     &number_of_hits,
+			     &number_of_misses,
+			     NULL ) == 1 )
+			{
+				libcnotify_printf(
+				 "%s: directory entries cache hits: %" PRIu64 ", misses: %" PRIu64 "\n",
+				 function,
+				 number_of_hits,
+				 number_of_misses );
+			}
 		}
 #endif
+		if( ( *file_system )->file_io_handle_pool != NULL )
+		{
+			if( libfsxfs_file_io_handle_pool_free(
+			     &( ( *file_system )->file_io_handle_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( shard_index = 0;
+		     shard_index < LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+		     shard_index++ )
+		{
+			if( libfsxfs_cache_shard_free(
+			     &( ( *file_system )->directory_entries_cache_shards[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free directory entries cache shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+			if( libfsxfs_cache_shard_free(
+			     &( ( *file_system )->inodes_cache_shards[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inodes cache shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
 		if( libfsxfs_inode_btree_free(
 		     &( ( *file_system )->inode_btree ),
 		     error ) != 1 )
@@ -210,17 +325,18 @@ int libfsxfs_file_system_free(
 	return( result );
 }
 
-/* Reads the inode information
+/* Creates the file IO handle pool
+ * The file IO handles of the pool are clones of file_io_handle that are used
+ * so that multiple threads can read data concurrently
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_system_read_inode_information(
+int libfsxfs_file_system_initialize_file_io_handle_pool(
      libfsxfs_file_system_t *file_system,
-     libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     int maximum_number_of_file_io_handles,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_file_system_read_inode_information";
+	static char *function = "libfsxfs_file_system_initialize_file_io_handle_pool";
 
 	if( file_system == NULL )
 	{
@@ -233,42 +349,47 @@ int libfsxfs_file_system_read_inode_information(
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_btree_read_inode_information(
-	     file_system->inode_btree,
-	     io_handle,
+	if( file_system->file_io_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file system - file IO handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_io_handle_pool_initialize(
+	     &( file_system->file_io_handle_pool ),
 	     file_io_handle,
-	     file_offset,
+	     maximum_number_of_file_io_handles,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle pool.",
+		 function );
 
-		return( 1 );
+		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a specific inode
- * Returns 1 if successful, 0 if no such value or -1 on error
+/* Grabs a file IO handle for exclusive use
+ * If the file system has a file IO handle pool a file IO handle is grabbed from
+ * the pool, otherwise file_io_handle is used
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_file_system_get_inode_by_number(
+int libfsxfs_file_system_grab_file_io_handle(
      libfsxfs_file_system_t *file_system,
-     libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t inode_number,
-     libfsxfs_inode_t **inode,
+     libbfio_handle_t **grabbed_file_io_handle,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *safe_inode = NULL;
-	static char *function        = "libfsxfs_file_system_get_inode_by_number";
-	off64_t file_offset          = 0;
-	int result                   = 0;
+	static char *function = "libfsxfs_file_system_grab_file_io_handle";
 
 	if( file_system == NULL )
 	{
@@ -281,114 +402,2073 @@ int libfsxfs_file_system_get_inode_by_number(
 
 		return( -1 );
 	}
-	if( io_handle == NULL )
+	if( grabbed_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid grabbed file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( io_handle->inode_size == 0 )
+	if( file_system->file_io_handle_pool == NULL )
+	{
+		*grabbed_file_io_handle = file_io_handle;
+
+		return( 1 );
+	}
+	if( libfsxfs_file_io_handle_pool_grab_file_io_handle(
+	     file_system->file_io_handle_pool,
+	     grabbed_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - inode size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle from pool.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( inode_number == 0 )
-	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	return( 1 );
+}
+
+/* Releases a file IO handle that was grabbed for exclusive use
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_release_file_io_handle(
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *grabbed_file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_release_file_io_handle";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_system->file_io_handle_pool == NULL )
+	 || ( grabbed_file_io_handle == file_io_handle ) )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_file_io_handle_pool_release_file_io_handle(
+	     file_system->file_io_handle_pool,
+	     grabbed_file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid inode number value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle to pool.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfsxfs_inode_btree_get_inode_by_number(
-	          file_system->inode_btree,
-	          io_handle,
-	          file_io_handle,
-	          inode_number,
-	          &file_offset,
-	          error );
+	return( 1 );
+}
 
-	if( result == -1 )
+/* Sets the number of allocation groups
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     off64_t inode_information_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_set_number_of_allocation_groups";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_set_number_of_allocation_groups(
+	     file_system->inode_btree,
+	     number_of_allocation_groups,
+	     inode_information_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of allocation groups in inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inode information of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_read_inode_information(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_read_inode_information";
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_read_inode_information(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 "\n",
+		 "%s: unable to read inode information: %" PRIu32 ".",
 		 function,
-		 inode_number );
+		 allocation_group_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	return( 1 );
+}
+
+/* Retrieves the inode information of a specific allocation group
+ * The inode information is read on demand if not available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_get_inode_information(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_file_system_get_inode_information";
+
+	if( file_system == NULL )
 	{
-		if( libfsxfs_inode_initialize(
-		     &safe_inode,
-		     io_handle->inode_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create inode.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 inode_number,
-			 file_offset,
-			 file_offset );
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_get_inode_information(
+	     file_system->inode_btree,
+	     io_handle,
+	     file_io_handle,
+	     allocation_group_index,
+	     inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific inode from the inodes cache
+ * Only the shard of the inode is locked while the caller receives a copy of the cached inode
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_file_system_get_inode_from_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsxfs_cache_shard_t *cache_shard  = NULL;
+	libfsxfs_inode_t *cached_inode       = NULL;
+	static char *function                = "libfsxfs_file_system_get_inode_from_cache";
+	int result                           = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	cache_shard = file_system->inodes_cache_shards[ inode_number % LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+
+	if( libfsxfs_cache_shard_grab(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab inodes cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache_shard->cache,
+	          0,
+	          (off64_t) inode_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) &cached_inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from cache value.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		if( libfsxfs_inode_read_file_io_handle(
-		     safe_inode,
-		     io_handle,
-		     file_io_handle,
-		     file_offset,
+		if( libfsxfs_inode_clone(
+		     inode,
+		     cached_inode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		cache_shard->number_of_hits++;
+	}
+	else
+	{
+		cache_shard->number_of_misses++;
+	}
+	if( libfsxfs_cache_shard_release(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release inodes cache shard.",
+		 function );
+
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libfsxfs_cache_shard_release(
+	 cache_shard,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sets an inode in the inodes cache
+ * If the inodes cache takes over management of the inode, inode is set to NULL.
+ * An inode that was cached by another thread is left as-is.
+ * The number of evictions is exact since a new inode only replaces another inode
+ * when the shard is full
+ * Returns 1 if successful, 0 if the inode was already cached or -1 on error
+ */
+int libfsxfs_file_system_set_inode_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value = NULL;
+	libfsxfs_cache_shard_t *cache_shard  = NULL;
+	static char *function                = "libfsxfs_file_system_set_inode_in_cache";
+	int number_of_cache_values           = 0;
+	int result                           = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode == NULL )
+	 || ( *inode == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	cache_shard = file_system->inodes_cache_shards[ inode_number % LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+
+	if( libfsxfs_cache_shard_grab(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab inodes cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfcache_cache_get_value_by_identifier(
+	          cache_shard->cache,
+	          0,
+	          (off64_t) inode_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libfcache_cache_get_number_of_cache_values(
+		     cache_shard->cache,
+		     &number_of_cache_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of cache values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfcache_cache_set_value_by_identifier(
+		     cache_shard->cache,
+		     0,
+		     (off64_t) inode_number,
+		     0,
+		     (intptr_t *) *inode,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_free,
+		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode: %" PRIu64 " in cache.",
 			 function,
-			 inode_number,
-			 file_offset,
-			 file_offset );
+			 inode_number );
+
+			goto on_error;
+		}
+		*inode = NULL;
+
+		if( number_of_cache_values >= cache_shard->maximum_number_of_cache_values )
+		{
+			cache_shard->number_of_evictions++;
+		}
+		result = 1;
+	}
+	else
+	{
+		result = 0;
+	}
+	if( libfsxfs_cache_shard_release(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release inodes cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libfsxfs_cache_shard_release(
+	 cache_shard,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the inode chunk that contains a specific inode
+ * The inode chunk is read with a single read. Besides the inode the other used
+ * inodes of the chunk are read ahead. Inodes that would require additional reads,
+ * such as inodes with a B+ tree data or attributes fork, are not read ahead.
+ * The inodes are stored in chunk_inodes by their index in the chunk, where
+ * chunk_inodes must contain 64 entries that are set to NULL
+ * This function does not access the inodes cache and therefore does not require
+ * a lock
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_read_inode_chunk(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     off64_t file_offset,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     uint64_t *chunk_inode_number,
+     libfsxfs_inode_t **chunk_inodes,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *safe_inode   = NULL;
+	const uint8_t *chunk_data      = NULL;
+	uint8_t *chunk_buffer          = NULL;
+	static char *function          = "libfsxfs_file_system_read_inode_chunk";
+	size_t chunk_data_offset       = 0;
+	size_t chunk_data_size         = 0;
+	ssize_t read_count             = 0;
+	off64_t chunk_offset           = 0;
+	uint64_t relative_inode_number = 0;
+	uint64_t safe_chunk_number     = 0;
+	uint8_t chunk_inode_index      = 0;
+	uint8_t first_inode_index      = 0;
+	uint8_t inode_index            = 0;
+	uint8_t last_inode_index       = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_btree_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree record.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inodes.",
+		 function );
+
+		return( -1 );
+	}
+	relative_inode_number = inode_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_inode_number_bits ) - 1 );
+
+	if( ( relative_inode_number < (uint64_t) inode_btree_record->inode_number )
+	 || ( relative_inode_number >= ( (uint64_t) inode_btree_record->inode_number + 64 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_inode_index = (uint8_t) ( relative_inode_number - inode_btree_record->inode_number );
+	safe_chunk_number = inode_number - chunk_inode_index;
+
+	/* Only read the range of the inode chunk that contains used inodes,
+	 * a bit in the chunk allocation bitmap is set if the inode is unused
+	 */
+	first_inode_index = chunk_inode_index;
+	last_inode_index  = chunk_inode_index;
+
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( ( inode_btree_record->chunk_allocation_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 )
+		{
+			continue;
+		}
+		if( inode_index < first_inode_index )
+		{
+			first_inode_index = inode_index;
+		}
+		if( inode_index > last_inode_index )
+		{
+			last_inode_index = inode_index;
+		}
+	}
+	chunk_offset    = file_offset - ( (off64_t) ( chunk_inode_index - first_inode_index ) * io_handle->inode_size );
+	chunk_data_size = (size_t) ( last_inode_index - first_inode_index + 1 ) * io_handle->inode_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading inode chunk: %" PRIu64 " - %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 safe_chunk_number + first_inode_index,
+		 safe_chunk_number + last_inode_index,
+		 chunk_offset,
+		 chunk_offset );
+	}
+#endif
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          chunk_offset,
+	          chunk_data_size,
+	          &chunk_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_offset,
+		 chunk_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		chunk_buffer = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * chunk_data_size );
+
+		if( chunk_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create inode chunk data.",
+			 function );
+
+			goto on_error;
+		}
+		/* The chunk is read at a specific offset so that concurrent lookups
+		 * do not depend on the current offset of the file IO handle
+		 */
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              chunk_buffer,
+		              chunk_data_size,
+		              chunk_offset,
+		              error );
+
+		if( read_count != (ssize_t) chunk_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			goto on_error;
+		}
+		chunk_data = chunk_buffer;
+	}
+	for( inode_index = first_inode_index;
+	     inode_index <= last_inode_index;
+	     inode_index++ )
+	{
+		if( ( inode_index != chunk_inode_index )
+		 && ( ( inode_btree_record->chunk_allocation_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 ) )
+		{
+			continue;
+		}
+		chunk_data_offset = (size_t) ( inode_index - first_inode_index ) * io_handle->inode_size;
+
+		if( libfsxfs_inode_initialize(
+		     &safe_inode,
+		     io_handle->inode_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create inode.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     safe_inode->data,
+		     &( chunk_data[ chunk_data_offset ] ),
+		     safe_inode->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inode data.",
+			 function );
+
+			goto on_error;
+		}
+		if( inode_index == chunk_inode_index )
+		{
+			if( libfsxfs_inode_read_data(
+			     safe_inode,
+			     io_handle,
+			     safe_inode->data,
+			     safe_inode->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			if( libfsxfs_inode_read_forks(
+			     safe_inode,
+			     io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 " forks.",
+				 function,
+				 inode_number );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		else
+		{
+			/* Errors of read ahead inodes are ignored, the inode will be read
+			 * again when it is requested
+			 */
+			result = libfsxfs_inode_read_data(
+			          safe_inode,
+			          io_handle,
+			          safe_inode->data,
+			          safe_inode->data_size,
+			          NULL );
+
+			if( ( result == 1 )
+			 && ( safe_inode->fork_type != LIBFSXFS_FORK_TYPE_BTREE )
+			 && ( safe_inode->attributes_fork_type != LIBFSXFS_FORK_TYPE_BTREE ) )
+			{
+				result = libfsxfs_inode_read_forks(
+				          safe_inode,
+				          io_handle,
+				          file_io_handle,
+				          NULL );
+			}
+			else
+			{
+				result = 0;
+			}
+		}
+		if( result == 1 )
+		{
+			chunk_inodes[ inode_index ] = safe_inode;
+			safe_inode                  = NULL;
+		}
+		else
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read ahead inode: %" PRIu64 ".\n",
+				 function,
+				 safe_chunk_number + inode_index );
+			}
+#endif
+			if( libfsxfs_inode_free(
+			     &safe_inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( chunk_buffer != NULL )
+	{
+		memory_free(
+		 chunk_buffer );
+	}
+	*chunk_inode_number = safe_chunk_number;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	if( chunk_buffer != NULL )
+	{
+		memory_free(
+		 chunk_buffer );
+	}
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( chunk_inodes[ inode_index ] != NULL )
+		{
+			libfsxfs_inode_free(
+			 &( chunk_inodes[ inode_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Sets the inodes of an inode chunk in the inodes cache
+ * The caller receives a copy of the inode, which is created without holding a lock.
+ * The other inodes of the chunk are set first and the inode last so that the inode
+ * is the most recently used value in its inodes cache shard. Inodes that were cached by
+ * another thread while the chunk was being read are left as-is.
+ * The inodes cache takes over management of the inodes that were set and their
+ * entries in chunk_inodes are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_inode_chunk_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     uint64_t chunk_inode_number,
+     libfsxfs_inode_t **chunk_inodes,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsxfs_file_system_set_inode_chunk_in_cache";
+	uint8_t chunk_inode_index = 0;
+	uint8_t inode_index       = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_number < chunk_inode_number )
+	 || ( inode_number >= ( chunk_inode_number + 64 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk inodes.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_inode_index = (uint8_t) ( inode_number - chunk_inode_number );
+
+	if( chunk_inodes[ chunk_inode_index ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunk inodes - missing inode: %" PRIu64 ".",
+		 function,
+		 inode_number );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_clone(
+	     inode,
+	     chunk_inodes[ chunk_inode_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( ( inode_index == chunk_inode_index )
+		 || ( chunk_inodes[ inode_index ] == NULL ) )
+		{
+			continue;
+		}
+		if( libfsxfs_file_system_set_inode_in_cache(
+		     file_system,
+		     chunk_inode_number + inode_index,
+		     &( chunk_inodes[ inode_index ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode: %" PRIu64 " in cache.",
+			 function,
+			 chunk_inode_number + inode_index );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_file_system_set_inode_in_cache(
+	     file_system,
+	     inode_number,
+	     &( chunk_inodes[ chunk_inode_index ] ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set inode: %" PRIu64 " in cache.",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific inode
+ * The inode is read from the inodes cache if available, otherwise it is read
+ * from the file IO handle and stored in the inodes cache. The caller receives
+ * a copy of the inode
+ * Only the inodes cache shard of an inode is locked while it is accessed. The inode
+ * B+ tree and the inode chunk are read without holding the lock of a shard so that
+ * lookups by multiple threads do not serialize on the IO
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfsxfs_file_system_get_inode_by_number(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *chunk_inodes[ 64 ];
+
+	libbfio_handle_t *chunk_file_io_handle            = NULL;
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	static char *function                             = "libfsxfs_file_system_get_inode_by_number";
+	off64_t file_offset                               = 0;
+	uint64_t chunk_inode_number                       = 0;
+	uint8_t inode_index                               = 0;
+	int result                                        = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode_number == 0 )
+	 || ( inode_number > (uint64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     chunk_inodes,
+	     0,
+	     sizeof( libfsxfs_inode_t * ) * 64 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk inodes.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_file_system_get_inode_from_cache(
+	          file_system,
+	          inode_number,
+	          inode,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from cache.",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     file_system,
+	     file_io_handle,
+	     &chunk_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_inode_btree_get_inode_by_number(
+	          file_system->inode_btree,
+	          io_handle,
+	          chunk_file_io_handle,
+	          inode_number,
+	          &file_offset,
+	          &inode_btree_record,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 " from inode B+ tree.",
+		 function,
+		 inode_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libfsxfs_file_system_read_inode_chunk(
+		     io_handle,
+		     chunk_file_io_handle,
+		     inode_number,
+		     file_offset,
+		     inode_btree_record,
+		     &chunk_inode_number,
+		     chunk_inodes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 inode_number,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_file_system_release_file_io_handle(
+	     file_system,
+	     file_io_handle,
+	     chunk_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		chunk_file_io_handle = NULL;
+
+		goto on_error;
+	}
+	chunk_file_io_handle = NULL;
+
+	if( result != 0 )
+	{
+		if( libfsxfs_inode_btree_record_free(
+		     &inode_btree_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode B+ tree record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_file_system_set_inode_chunk_in_cache(
+		     file_system,
+		     inode_number,
+		     chunk_inode_number,
+		     chunk_inodes,
+		     inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode chunk in cache.",
+			 function );
+
+			goto on_error;
+		}
+		/* Free the inodes that were cached by another thread
+		 */
+		for( inode_index = 0;
+		     inode_index < 64;
+		     inode_index++ )
+		{
+			if( chunk_inodes[ inode_index ] != NULL )
+			{
+				if( libfsxfs_inode_free(
+				     &( chunk_inodes[ inode_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free inode.",
+					 function );
+
+					goto on_error;
+				}
+			}
+		}
+	}
+	return( result );
+
+on_error:
+	if( chunk_file_io_handle != NULL )
+	{
+		libfsxfs_file_system_release_file_io_handle(
+		 file_system,
+		 file_io_handle,
+		 chunk_file_io_handle,
+		 NULL );
+	}
+	if( inode_btree_record != NULL )
+	{
+		libfsxfs_inode_btree_record_free(
+		 &inode_btree_record,
+		 NULL );
+	}
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( chunk_inodes[ inode_index ] != NULL )
+		{
+			libfsxfs_inode_free(
+			 &( chunk_inodes[ inode_index ] ),
+			 NULL );
+		}
+	}
+	if( *inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inodes cache statistics
+ * The number of evictions is exact, an eviction is only counted when a full cache shard
+ * replaces a cached inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_get_inodes_cache_statistics(
+     libfsxfs_file_system_t *file_system,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_file_system_get_inodes_cache_statistics";
+	uint64_t shard_evictions = 0;
+	uint64_t shard_hits      = 0;
+	uint64_t shard_misses    = 0;
+	uint64_t safe_evictions  = 0;
+	uint64_t safe_hits       = 0;
+	uint64_t safe_misses     = 0;
+	int shard_index          = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+	     shard_index++ )
+	{
+		if( libfsxfs_cache_shard_get_statistics(
+		     file_system->inodes_cache_shards[ shard_index ],
+		     &shard_hits,
+		     &shard_misses,
+		     &shard_evictions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inodes cache shard: %d statistics.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		safe_hits      += shard_hits;
+		safe_misses    += shard_misses;
+		safe_evictions += shard_evictions;
+	}
+	*number_of_hits      = safe_hits;
+	*number_of_misses    = safe_misses;
+	*number_of_evictions = safe_evictions;
+
+	return( 1 );
+}
+
+/* Retrieves a directory entry from the directory entries cache
+ * The directory entries cache contains both existing (positive) and non-existing (negative) entries,
+ * for a negative entry directory_entry is set to NULL
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_file_system_get_directory_entry_from_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value               = NULL;
+	libfsxfs_cache_shard_t *cache_shard                = NULL;
+	libfsxfs_directory_entry_t *cached_directory_entry = NULL;
+	static char *function                              = "libfsxfs_file_system_get_directory_entry_from_cache";
+	off64_t cache_value_offset                         = 0;
+	int64_t cache_value_timestamp                      = 0;
+	uint32_t name_hash                                 = 0;
+	int cache_entry_index                              = 0;
+	int cache_value_file_index                         = 0;
+	int result                                         = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > 255 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_name_hash_calculate(
+	     &name_hash,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry_index = (int) ( ( parent_inode_number ^ name_hash ) % LIBFSXFS_MAXIMUM_CACHE_ENTRIES_DIRECTORY_ENTRIES );
+	cache_shard       = file_system->directory_entries_cache_shards[ cache_entry_index % LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+	cache_entry_index = cache_entry_index / LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+
+	if( libfsxfs_cache_shard_grab(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab directory entries cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_value_by_index(
+	     cache_shard->cache,
+	     cache_entry_index,
+	     &cache_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache value: %d.",
+		 function,
+		 cache_entry_index );
+
+		goto on_error;
+	}
+	if( cache_value != NULL )
+	{
+		if( libfcache_cache_value_get_identifier(
+		     cache_value,
+		     &cache_value_file_index,
+		     &cache_value_offset,
+		     &cache_value_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache value identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( cache_value_offset == (off64_t) parent_inode_number )
+		 && ( cache_value_timestamp == (int64_t) name_hash ) )
+		{
+			if( libfcache_cache_value_get_value(
+			     cache_value,
+			     (intptr_t **) &cached_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve directory entry from cache value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* Different names can have the same name hash
+	 */
+	if( ( cached_directory_entry != NULL )
+	 && ( cached_directory_entry->name_size == (uint8_t) name_size )
+	 && ( memory_compare(
+	       cached_directory_entry->name,
+	       name,
+	       name_size ) == 0 ) )
+	{
+		if( cached_directory_entry->inode_number != 0 )
+		{
+			if( libfsxfs_directory_entry_clone(
+			     directory_entry,
+			     cached_directory_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create directory entry.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		cache_shard->number_of_hits++;
+
+		result = 1;
+	}
+	else
+	{
+		cache_shard->number_of_misses++;
+	}
+	if( libfsxfs_cache_shard_release(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release directory entries cache shard.",
+		 function );
+
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libfsxfs_cache_shard_release(
+	 cache_shard,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Sets a directory entry in the directory entries cache
+ * A directory entry of NULL stores a negative entry, that indicates the name does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_set_directory_entry_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_cache_shard_t *cache_shard                = NULL;
+	libfsxfs_directory_entry_t *cached_directory_entry = NULL;
+	static char *function                              = "libfsxfs_file_system_set_directory_entry_in_cache";
+	uint32_t name_hash                                 = 0;
+	int cache_entry_index                              = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > 255 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_name_hash_calculate(
+	     &name_hash,
+	     name,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate name hash.",
+		 function );
+
+		goto on_error;
+	}
+	cache_entry_index = (int) ( ( parent_inode_number ^ name_hash ) % LIBFSXFS_MAXIMUM_CACHE_ENTRIES_DIRECTORY_ENTRIES );
+	cache_shard       = file_system->directory_entries_cache_shards[ cache_entry_index % LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+	cache_entry_index = cache_entry_index / LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+
+	if( libfsxfs_directory_entry_initialize(
+	     &cached_directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cached directory entry contains the name that was looked up, which is used
+	 * to detect name hash collisions, and an inode number of 0 for a negative entry
+	 */
+	if( directory_entry != NULL )
+	{
+		cached_directory_entry->inode_number = directory_entry->inode_number;
+	}
+	if( memory_copy(
+	     cached_directory_entry->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	cached_directory_entry->name_size = (uint8_t) name_size;
+
+	if( libfsxfs_cache_shard_grab(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab directory entries cache shard.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_set_value_by_index(
+	     cache_shard->cache,
+	     cache_entry_index,
+	     0,
+	     (off64_t) parent_inode_number,
+	     (int64_t) name_hash,
+	     (intptr_t *) cached_directory_entry,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_directory_entry_free,
+	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory entry in cache.",
+		 function );
+
+		libfsxfs_cache_shard_release(
+		 cache_shard,
+		 NULL );
+
+		goto on_error;
+	}
+	cached_directory_entry = NULL;
+
+	if( libfsxfs_cache_shard_release(
+	     cache_shard,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release directory entries cache shard.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( cached_directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 &cached_directory_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the directory entries cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_file_system_get_directory_entries_cache_statistics(
+     libfsxfs_file_system_t *file_system,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfsxfs_file_system_get_directory_entries_cache_statistics";
+	uint64_t shard_evictions = 0;
+	uint64_t shard_hits      = 0;
+	uint64_t shard_misses    = 0;
+	uint64_t safe_hits       = 0;
+	uint64_t safe_misses     = 0;
+	int shard_index          = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSXFS_NUMBER_OF_CACHE_SHARDS;
+	     shard_index++ )
+	{
+		if( libfsxfs_cache_shard_get_statistics(
+		     file_system->directory_entries_cache_shards[ shard_index ],
+		     &shard_hits,
+		     &shard_misses,
+		     &shard_evictions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entries cache shard: %d statistics.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+		safe_hits   += shard_hits;
+		safe_misses += shard_misses;
+	}
+	*number_of_hits   = safe_hits;
+	*number_of_misses = safe_misses;
+
+	return( 1 );
+}
+
+/* Retrieves a directory entry for a specific name in a parent directory
+ * The name is the UTF-8 encoded name as stored on disk
+ * The directory entries cache is used to prevent reading the parent directory
+ * for names that were looked up before
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_file_system_get_directory_entry_by_name(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *directory_file_io_handle = NULL;
+	libfsxfs_inode_t *parent_inode             = NULL;
+	static char *function                      = "libfsxfs_file_system_get_directory_entry_by_name";
+	int result                                 = 0;
+
+	if( directory_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Names longer than 255 bytes cannot be stored in a directory entry
+	 */
+	if( ( name_size == 0 )
+	 || ( name_size > 255 ) )
+	{
+		return( 0 );
+	}
+	result = libfsxfs_file_system_get_directory_entry_from_cache(
+	          file_system,
+	          parent_inode_number,
+	          name,
+	          name_size,
+	          directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( *directory_entry == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	if( libfsxfs_file_system_get_inode_by_number(
+	     file_system,
+	     io_handle,
+	     file_io_handle,
+	     parent_inode_number,
+	     &parent_inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 parent_inode_number );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_system_grab_file_io_handle(
+	     file_system,
+	     file_io_handle,
+	     &directory_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsxfs_directory_get_entry_from_inode_by_utf8_name(
+	          io_handle,
+	          directory_file_io_handle,
+	          parent_inode,
+	          name,
+	          name_size,
+	          directory_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entry by UTF-8 name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_system_release_file_io_handle(
+	     file_system,
+	     file_io_handle,
+	     directory_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		directory_file_io_handle = NULL;
+
+		goto on_error;
+	}
+	directory_file_io_handle = NULL;
+
+	if( libfsxfs_inode_free(
+	     &parent_inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_file_system_set_directory_entry_in_cache(
+	     file_system,
+	     parent_inode_number,
+	     name,
+	     name_size,
+	     *directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set directory entry in cache.",
+		 function );
 
-			goto on_error;
-		}
-		*inode = safe_inode;
+		goto on_error;
 	}
 	return( result );
 
 on_error:
-	if( safe_inode != NULL )
+	if( directory_file_io_handle != NULL )
+	{
+		libfsxfs_file_system_release_file_io_handle(
+		 file_system,
+		 file_io_handle,
+		 directory_file_io_handle,
+		 NULL );
+	}
+	if( *directory_entry != NULL )
+	{
+		libfsxfs_directory_entry_free(
+		 directory_entry,
+		 NULL );
+	}
+	if( parent_inode != NULL )
 	{
 		libfsxfs_inode_free(
-		 &safe_inode,
+		 &parent_inode,
 		 NULL );
 	}
 	return( -1 );
@@ -408,7 +2488,6 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
 	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
 	libfsxfs_inode_t *safe_inode                     = NULL;
 	const uint8_t *utf8_string_segment               = NULL;
@@ -485,24 +2564,6 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	safe_inode_number = file_system->root_directory_inode_number;
 
-	if( libfsxfs_file_system_get_inode_by_number(
-	     file_system,
-	     io_handle,
-	     file_io_handle,
-	     safe_inode_number,
-	     &safe_inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 safe_inode_number );
-
-		goto on_error;
-	}
 	if( ( utf8_string_length == 0 )
 	 || ( utf8_string_length == 1 ) )
 	{
@@ -510,52 +2571,22 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 	}
 	else while( utf8_string_index < utf8_string_length )
 	{
-		if( directory != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
 		utf8_string_segment        = &( utf8_string[ utf8_string_index ] );
 		utf8_string_segment_length = utf8_string_index;
 
@@ -593,8 +2624,11 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf8_name(
-			          directory,
+			result = libfsxfs_file_system_get_directory_entry_by_name(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          safe_inode_number,
 			          utf8_string_segment,
 			          utf8_string_segment_length,
 			          &safe_directory_entry,
@@ -629,105 +2663,55 @@ int libfsxfs_file_system_get_directory_entry_by_utf8_path(
 
 			goto on_error;
 		}
-		if( safe_inode != NULL )
-		{
-			if( libfsxfs_inode_free(
-			     &safe_inode,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free inode.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( libfsxfs_file_system_get_inode_by_number(
-		     file_system,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode_number,
-		     &safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode: %" PRIu32 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
 	}
 	if( result == 0 )
 	{
-		if( safe_inode != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_inode_free(
-			     &safe_inode,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free inode.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
 	}
-	else
-	{
-		if( libfsxfs_directory_entry_clone(
-		     directory_entry,
-		     safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	/* Directory needs to be freed after making a clone of directory_entry
-	 */
-	if( directory != NULL )
+	else if( libfsxfs_file_system_get_inode_by_number(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          safe_inode_number,
+	          &safe_inode,
+	          error ) != 1 )
 	{
-		if( libfsxfs_directory_free(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 safe_inode_number );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	*inode_number = safe_inode_number;
-	*inode        = safe_inode;
+	*inode_number    = safe_inode_number;
+	*inode           = safe_inode;
+	*directory_entry = safe_directory_entry;
 
 	return( result );
 
 on_error:
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		libfsxfs_directory_free(
-		 &directory,
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
 		 NULL );
 	}
 	if( safe_inode != NULL )
@@ -736,12 +2720,6 @@ on_error:
 		 &safe_inode,
 		 NULL );
 	}
-	if( *directory_entry != NULL )
-	{
-		libfsxfs_directory_entry_free(
-		 directory_entry,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -759,14 +2737,14 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
      libfsxfs_directory_entry_t **directory_entry,
      libcerror_error_t **error )
 {
-	libfsxfs_directory_t *directory                  = NULL;
+	uint8_t name[ 256 + 4 ];
+
 	libfsxfs_directory_entry_t *safe_directory_entry = NULL;
 	libfsxfs_inode_t *safe_inode                     = NULL;
-	const uint16_t *utf16_string_segment             = NULL;
 	static char *function                            = "libfsxfs_file_system_get_directory_entry_by_utf16_path";
 	libuna_unicode_character_t unicode_character     = 0;
+	size_t name_size                                 = 0;
 	size_t utf16_string_index                        = 0;
-	size_t utf16_string_segment_length               = 0;
 	uint64_t safe_inode_number                       = 0;
 	int result                                       = 0;
 
@@ -836,24 +2814,6 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	safe_inode_number = file_system->root_directory_inode_number;
 
-	if( libfsxfs_file_system_get_inode_by_number(
-	     file_system,
-	     io_handle,
-	     file_io_handle,
-	     safe_inode_number,
-	     &safe_inode,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode: %" PRIu64 ".",
-		 function,
-		 safe_inode_number );
-
-		goto on_error;
-	}
 	if( ( utf16_string_length == 0 )
 	 || ( utf16_string_length == 1 ) )
 	{
@@ -861,54 +2821,26 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 	}
 	else while( utf16_string_index < utf16_string_length )
 	{
-		if( directory != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_directory_free(
-			     &directory,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
-		if( libfsxfs_directory_initialize(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_directory_read_file_io_handle(
-		     directory,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read directory from inode: %" PRIu64 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
-		utf16_string_segment        = &( utf16_string[ utf16_string_index ] );
-		utf16_string_segment_length = utf16_string_index;
+		/* The name is converted to UTF-8 since that is how names are stored on disk
+		 * and how they are stored in the directory entries cache
+		 */
+		name_size = 0;
 
 		while( utf16_string_index < utf16_string_length )
 		{
@@ -931,23 +2863,45 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 			if( ( unicode_character == (libuna_unicode_character_t) LIBFSXFS_SEPARATOR )
 			 || ( unicode_character == 0 ) )
 			{
-				utf16_string_segment_length += 1;
-
 				break;
 			}
-		}
-		utf16_string_segment_length = utf16_string_index - utf16_string_segment_length;
+			/* Names longer than 255 bytes cannot be stored in a directory entry
+			 */
+			if( name_size > 255 )
+			{
+				continue;
+			}
+			if( libuna_unicode_character_copy_to_utf8(
+			     unicode_character,
+			     name,
+			     256 + 4,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8 name.",
+				 function );
 
-		if( utf16_string_segment_length == 0 )
+				goto on_error;
+			}
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > 255 ) )
 		{
 			result = 0;
 		}
 		else
 		{
-			result = libfsxfs_directory_get_entry_by_utf16_name(
-			          directory,
-			          utf16_string_segment,
-			          utf16_string_segment_length,
+			result = libfsxfs_file_system_get_directory_entry_by_name(
+			          file_system,
+			          io_handle,
+			          file_io_handle,
+			          safe_inode_number,
+			          name,
+			          name_size,
 			          &safe_directory_entry,
 			          error );
 		}
@@ -980,105 +2934,55 @@ int libfsxfs_file_system_get_directory_entry_by_utf16_path(
 
 			goto on_error;
 		}
-		if( safe_inode != NULL )
-		{
-			if( libfsxfs_inode_free(
-			     &safe_inode,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free inode.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( libfsxfs_file_system_get_inode_by_number(
-		     file_system,
-		     io_handle,
-		     file_io_handle,
-		     safe_inode_number,
-		     &safe_inode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode: %" PRIu32 ".",
-			 function,
-			 safe_inode_number );
-
-			goto on_error;
-		}
 	}
 	if( result == 0 )
 	{
-		if( safe_inode != NULL )
+		if( safe_directory_entry != NULL )
 		{
-			if( libfsxfs_inode_free(
-			     &safe_inode,
+			if( libfsxfs_directory_entry_free(
+			     &safe_directory_entry,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free inode.",
+				 "%s: unable to free directory entry.",
 				 function );
 
 				goto on_error;
 			}
 		}
 	}
-	else
-	{
-		if( libfsxfs_directory_entry_clone(
-		     directory_entry,
-		     safe_directory_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create directory entry.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	/* Directory needs to be freed after making a clone of directory_entry
-	 */
-	if( directory != NULL )
+	else if( libfsxfs_file_system_get_inode_by_number(
+	          file_system,
+	          io_handle,
+	          file_io_handle,
+	          safe_inode_number,
+	          &safe_inode,
+	          error ) != 1 )
 	{
-		if( libfsxfs_directory_free(
-		     &directory,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode: %" PRIu64 ".",
+		 function,
+		 safe_inode_number );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	*inode_number = safe_inode_number;
-	*inode        = safe_inode;
+	*inode_number    = safe_inode_number;
+	*inode           = safe_inode;
+	*directory_entry = safe_directory_entry;
 
 	return( result );
 
 on_error:
-	if( directory != NULL )
+	if( safe_directory_entry != NULL )
 	{
-		libfsxfs_directory_free(
-		 &directory,
+		libfsxfs_directory_entry_free(
+		 &safe_directory_entry,
 		 NULL );
 	}
 	if( safe_inode != NULL )
@@ -1087,12 +2991,6 @@ on_error:
 		 &safe_inode,
 		 NULL );
 	}
-	if( *directory_entry != NULL )
-	{
-		libfsxfs_directory_entry_free(
-		 directory_entry,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -25,12 +25,17 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_cache_shard.h"
+#include "libfsxfs_definitions.h"
 #include "libfsxfs_directory_entry.h"
+#include "libfsxfs_file_io_handle_pool.h"
 #include "libfsxfs_inode.h"
 #include "libfsxfs_inode_btree.h"
+#include "libfsxfs_inode_btree_record.h"
+#include "libfsxfs_inode_information.h"
+#include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcerror.h"
-#include "libfsxfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -48,11 +53,19 @@ struct libfsxfs_file_system
 	 */
 	uint64_t root_directory_inode_number;
 
-#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	/* The read/write lock
+	/* The inodes cache shards
+	 * An inode is cached in the shard of its inode number modulo the number of shards
 	 */
-	libcthreads_read_write_lock_t *read_write_lock;
-#endif
+	libfsxfs_cache_shard_t *inodes_cache_shards[ LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+
+	/* The directory entries cache shards
+	 * A directory entry is cached in the shard of its cache entry index modulo the number of shards
+	 */
+	libfsxfs_cache_shard_t *directory_entries_cache_shards[ LIBFSXFS_NUMBER_OF_CACHE_SHARDS ];
+
+	/* The file IO handle pool
+	 */
+	libfsxfs_file_io_handle_pool_t *file_io_handle_pool;
 };
 
 int libfsxfs_file_system_initialize(
@@ -64,11 +77,73 @@ int libfsxfs_file_system_free(
      libfsxfs_file_system_t **file_system,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_initialize_file_io_handle_pool(
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_grab_file_io_handle(
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t **grabbed_file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_release_file_io_handle(
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libbfio_handle_t *grabbed_file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_number_of_allocation_groups(
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     off64_t inode_information_offset,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_read_inode_information(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_inode_information(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_inode_from_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_inode_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_read_inode_chunk(
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t inode_number,
      off64_t file_offset,
+     libfsxfs_inode_btree_record_t *inode_btree_record,
+     uint64_t *chunk_inode_number,
+     libfsxfs_inode_t **chunk_inodes,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_inode_chunk_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t inode_number,
+     uint64_t chunk_inode_number,
+     libfsxfs_inode_t **chunk_inodes,
+     libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
 int libfsxfs_file_system_get_inode_by_number(
@@ -79,6 +154,45 @@ int libfsxfs_file_system_get_inode_by_number(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_file_system_get_inodes_cache_statistics(
+     libfsxfs_file_system_t *file_system,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_directory_entry_from_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_set_directory_entry_in_cache(
+     libfsxfs_file_system_t *file_system,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t *directory_entry,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_directory_entries_cache_statistics(
+     libfsxfs_file_system_t *file_system,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int libfsxfs_file_system_get_directory_entry_by_name(
+     libfsxfs_file_system_t *file_system,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t parent_inode_number,
+     const uint8_t *name,
+     size_t name_size,
+     libfsxfs_directory_entry_t **directory_entry,
+     libcerror_error_t **error );
+
 int libfsxfs_file_system_get_directory_entry_by_utf8_path(
      libfsxfs_file_system_t *file_system,
      libfsxfs_io_handle_t *io_handle,
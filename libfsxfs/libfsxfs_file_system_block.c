@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_file_system_block.h"
 #include "libfsxfs_file_system_block_header.h"
 #include "libfsxfs_io_handle.h"
@@ -110,20 +111,6 @@ int libfsxfs_file_system_block_initialize(
 
 		return( -1 );
 	}
-	( *file_system_block )->data = (uint8_t *) memory_allocate(
-	                                            sizeof( uint8_t ) * block_size );
-
-	if( ( *file_system_block )->data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create file system block data.",
-		 function );
-
-		goto on_error;
-	}
 	( *file_system_block )->data_size = block_size;
 
 	return( 1 );
@@ -178,9 +165,11 @@ int libfsxfs_file_system_block_free(
 				result = -1;
 			}
 		}
-		memory_free(
-		 ( *file_system_block )->data );
-
+		if( ( *file_system_block )->buffer != NULL )
+		{
+			memory_free(
+			 ( *file_system_block )->buffer );
+		}
 		memory_free(
 		 *file_system_block );
 
@@ -201,6 +190,7 @@ int libfsxfs_file_system_block_read_data(
 {
 	static char *function   = "libfsxfs_file_system_block_read_data";
 	size_t header_data_size = 0;
+	int result              = 0;
 
 	if( file_system_block == NULL )
 	{
@@ -295,6 +285,46 @@ int libfsxfs_file_system_block_read_data(
 
 		goto on_error;
 	}
+	/* The checksum covers the entire directory or attributes block, hence
+	 * it is only verified if the data contains the entire block
+	 */
+	if( ( io_handle->format_version == 5 )
+	 && ( io_handle->verify_checksums != 0 ) )
+	{
+		if( ( data_size == (size_t) io_handle->directory_block_size )
+		 || ( ( data_size == (size_t) io_handle->block_size )
+		  && ( file_system_block->header->signature == 0x3bee ) ) )
+		{
+			result = libfsxfs_checksum_verify_metadata(
+			          data,
+			          data_size,
+			          (size_t) ( ( (fsxfs_file_system_block_header_v3_t *) data )->checksum - data ),
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to verify file system block checksum.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_INPUT,
+				 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+				 "%s: mismatch in file system block checksum.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	return( 1 );
 
 on_error:
@@ -317,8 +347,10 @@ int libfsxfs_file_system_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libfsxfs_file_system_block_read_file_io_handle";
-	ssize_t read_count    = 0;
+	static char *function      = "libfsxfs_file_system_block_read_file_io_handle";
+	const uint8_t *mapped_data = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
 
 	if( file_system_block == NULL )
 	{
@@ -352,26 +384,76 @@ int libfsxfs_file_system_block_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              file_system_block->data,
-	              file_system_block->data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) file_system_block->data_size )
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          file_system_block->data_size,
+	          &mapped_data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file system block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		/* The file system block is parsed directly from the memory mapped volume data
+		 */
+		file_system_block->data = (uint8_t *) mapped_data;
+	}
+	else
+	{
+		/* The buffer is only allocated when the block is not memory mapped
+		 */
+		if( file_system_block->buffer == NULL )
+		{
+			file_system_block->buffer = (uint8_t *) memory_allocate(
+			                                         sizeof( uint8_t ) * file_system_block->data_size );
+
+			if( file_system_block->buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create file system block data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		file_system_block->data = file_system_block->buffer;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              file_system_block->buffer,
+		              file_system_block->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) file_system_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file system block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
 	if( libfsxfs_file_system_block_read_data(
 	     file_system_block,
 	     io_handle,
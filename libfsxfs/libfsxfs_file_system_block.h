@@ -38,7 +38,7 @@ typedef struct libfsxfs_file_system_block libfsxfs_file_system_block_t;
 
 struct libfsxfs_file_system_block
 {
-	/* Data
+	/* Data, which either refers to the buffer or the memory mapped volume data
 	 */
 	uint8_t *data;
 
@@ -46,6 +46,10 @@ struct libfsxfs_file_system_block
 	 */
 	size_t data_size;
 
+	/* The buffer, which is only allocated when the block is not memory mapped
+	 */
+	uint8_t *buffer;
+
 	/* Header
 	 */
 	libfsxfs_file_system_block_header_t *header;
@@ -25,9 +25,11 @@
 #include <types.h>
 
 #include "libfsxfs_attribute_values.h"
+#include "libfsxfs_checksum.h"
 #include "libfsxfs_debug.h"
 #include "libfsxfs_definitions.h"
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
 #include "libfsxfs_extent_btree.h"
 #include "libfsxfs_extent_list.h"
 #include "libfsxfs_inode.h"
@@ -178,9 +180,8 @@ int libfsxfs_inode_free(
 		}
 		if( ( *inode )->data_extents_array != NULL )
 		{
-			if( libcdata_array_free(
+			if( libfsxfs_extent_array_free(
 			     &( ( *inode )->data_extents_array ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -193,11 +194,26 @@ int libfsxfs_inode_free(
 				result = -1;
 			}
 		}
+		if( ( *inode )->data_extent_btree != NULL )
+		{
+			if( libfsxfs_extent_btree_free(
+			     &( ( *inode )->data_extent_btree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data extent B+ tree.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *inode )->attributes_extents_array != NULL )
 		{
-			if( libcdata_array_free(
+			if( libfsxfs_extent_array_free(
 			     &( ( *inode )->attributes_extents_array ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -218,6 +234,347 @@ int libfsxfs_inode_free(
 	return( result );
 }
 
+/* Clones an inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_clone(
+     libfsxfs_inode_t **destination_inode,
+     libfsxfs_inode_t *source_inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *safe_inode = NULL;
+	static char *function        = "libfsxfs_inode_clone";
+
+	if( destination_inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_inode == NULL )
+	{
+		*destination_inode = NULL;
+
+		return( 1 );
+	}
+	safe_inode = memory_allocate_structure(
+	              libfsxfs_inode_t );
+
+	if( safe_inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_inode,
+	     source_inode,
+	     sizeof( libfsxfs_inode_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination inode.",
+		 function );
+
+		memory_free(
+		 safe_inode );
+
+		return( -1 );
+	}
+	safe_inode->data                     = NULL;
+	safe_inode->inline_data              = NULL;
+	safe_inode->data_extents_array       = NULL;
+	safe_inode->data_extent_btree        = NULL;
+	safe_inode->inline_attributes_data   = NULL;
+	safe_inode->attributes_extents_array = NULL;
+
+	safe_inode->data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * source_inode->data_size );
+
+	if( safe_inode->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination inode data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_inode->data,
+	     source_inode->data,
+	     source_inode->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination inode data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The inline data references the inode data and needs to be
+	 * relocated to the destination inode data
+	 */
+	if( source_inode->inline_data != NULL )
+	{
+		safe_inode->inline_data = &( safe_inode->data[ source_inode->inline_data - source_inode->data ] );
+	}
+	if( source_inode->inline_attributes_data != NULL )
+	{
+		safe_inode->inline_attributes_data = &( safe_inode->data[ source_inode->inline_attributes_data - source_inode->data ] );
+	}
+	if( libfsxfs_extent_array_clone(
+	     &( safe_inode->data_extents_array ),
+	     source_inode->data_extents_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination data extents array.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data extent B+ tree is shared so that the nodes it cached
+	 * remain available to the destination inode
+	 */
+	if( source_inode->data_extent_btree != NULL )
+	{
+		if( libfsxfs_extent_btree_get_reference(
+		     &( safe_inode->data_extent_btree ),
+		     source_inode->data_extent_btree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reference to source data extent B+ tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfsxfs_extent_array_clone(
+	     &( safe_inode->attributes_extents_array ),
+	     source_inode->attributes_extents_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination attributes extents array.",
+		 function );
+
+		goto on_error;
+	}
+	*destination_inode = safe_inode;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Clones the (extended) attributes of an inode
+ * The destination inode only contains the inline attributes data and
+ * the attributes extents, the data fork is not copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_clone_attributes(
+     libfsxfs_inode_t **destination_inode,
+     libfsxfs_inode_t *source_inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *safe_inode = NULL;
+	static char *function        = "libfsxfs_inode_clone_attributes";
+
+	if( destination_inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_inode == NULL )
+	{
+		*destination_inode = NULL;
+
+		return( 1 );
+	}
+	if( source_inode->inline_attributes_data != NULL )
+	{
+		if( ( source_inode->inline_attributes_data < source_inode->data )
+		 || ( (size_t) source_inode->attributes_fork_size > source_inode->data_size )
+		 || ( (size_t) ( source_inode->inline_attributes_data - source_inode->data ) > ( source_inode->data_size - source_inode->attributes_fork_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid source inode - inline attributes data value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_inode = memory_allocate_structure(
+	              libfsxfs_inode_t );
+
+	if( safe_inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_inode,
+	     source_inode,
+	     sizeof( libfsxfs_inode_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination inode.",
+		 function );
+
+		memory_free(
+		 safe_inode );
+
+		return( -1 );
+	}
+	safe_inode->data                     = NULL;
+	safe_inode->data_size                = 0;
+	safe_inode->inline_data              = NULL;
+	safe_inode->number_of_data_extents   = 0;
+	safe_inode->data_extents_array       = NULL;
+	safe_inode->data_extent_btree        = NULL;
+	safe_inode->inline_attributes_data   = NULL;
+	safe_inode->attributes_extents_array = NULL;
+
+	/* Only the inline attributes data is copied, it is relocated
+	 * to the start of the destination inode data
+	 */
+	if( ( source_inode->inline_attributes_data != NULL )
+	 && ( source_inode->attributes_fork_size > 0 ) )
+	{
+		safe_inode->data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * source_inode->attributes_fork_size );
+
+		if( safe_inode->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create destination inode data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_inode->data_size = (size_t) source_inode->attributes_fork_size;
+
+		if( memory_copy(
+		     safe_inode->data,
+		     source_inode->inline_attributes_data,
+		     safe_inode->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source to destination inline attributes data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_inode->inline_attributes_data = safe_inode->data;
+	}
+	if( libfsxfs_extent_array_clone(
+	     &( safe_inode->attributes_extents_array ),
+	     source_inode->attributes_extents_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination attributes extents array.",
+		 function );
+
+		goto on_error;
+	}
+	*destination_inode = safe_inode;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the inode data
  * Returns 1 if successful or -1 on error
  */
@@ -237,6 +594,7 @@ int libfsxfs_inode_read_data(
 	uint64_t posix_seconds     = 0;
 	uint32_t value_32bit       = 0;
 	uint8_t format_version     = 0;
+	int result                 = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint64_t value_64bit       = 0;
@@ -336,6 +694,38 @@ int libfsxfs_inode_read_data(
 
 		return( -1 );
 	}
+	if( ( format_version == 3 )
+	 && ( io_handle->verify_checksums != 0 ) )
+	{
+		result = libfsxfs_checksum_verify_metadata(
+		          data,
+		          data_size,
+		          (size_t) ( ( (fsxfs_inode_v3_t *) data )->checksum - data ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to verify inode checksum.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_INPUT,
+			 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+			 "%s: mismatch in inode checksum.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	byte_stream_copy_to_uint16_big_endian(
 	 ( (fsxfs_inode_v1_t *) data )->file_mode,
 	 inode->file_mode );
@@ -1178,11 +1568,10 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libfsxfs_extent_btree_t *extent_btree = NULL;
-	static char *function                 = "libfsxfs_inode_read_file_io_handle";
-	ssize_t read_count                    = 0;
-	uint64_t number_of_blocks             = 0;
-	uint8_t add_sparse_extents            = 0;
+	static char *function      = "libfsxfs_inode_read_file_io_handle";
+	const uint8_t *mapped_data = NULL;
+	ssize_t read_count         = 0;
+	int result                 = 0;
 
 	if( inode == NULL )
 	{
@@ -1206,17 +1595,6 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( io_handle->block_size == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid IO handle - block size value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1227,27 +1605,67 @@ int libfsxfs_inode_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              inode->data,
-	              inode->data_size,
-	              file_offset,
-	              error );
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          inode->data_size,
+	          &mapped_data,
+	          error );
 
-	if( read_count != (ssize_t) inode->data_size )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
-	if( libfsxfs_inode_read_data(
+	else if( result != 0 )
+	{
+		if( memory_copy(
+		     inode->data,
+		     mapped_data,
+		     inode->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inode data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              inode->data,
+		              inode->data_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) inode->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_inode_read_data(
 	     inode,
 	     io_handle,
 	     inode->data,
@@ -1265,6 +1683,96 @@ int libfsxfs_inode_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( libfsxfs_inode_read_forks(
+	     inode,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode forks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the inode data and (extended) attributes forks
+ * The inode data must have been read before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	static char *function                 = "libfsxfs_inode_read_forks";
+	uint64_t number_of_blocks             = 0;
+	uint8_t add_sparse_extents            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->data_extents_array != NULL )
+	 || ( inode->data_extent_btree != NULL )
+	 || ( inode->attributes_extents_array != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - extents array value already set.",
+		 function );
+
+		return( -1 );
+	}
 	number_of_blocks = inode->size / io_handle->block_size;
 
 	if( ( inode->size % io_handle->block_size ) != 0 )
@@ -1326,9 +1834,8 @@ int libfsxfs_inode_read_file_io_handle(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libcdata_array_initialize(
+		if( libfsxfs_extent_array_initialize(
 		     &( inode->data_extents_array ),
-		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1374,65 +1881,41 @@ int libfsxfs_inode_read_file_io_handle(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( libcdata_array_initialize(
-		     &( inode->data_extents_array ),
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents array.",
-			 function );
-
-			goto on_error;
-		}
 		if( libfsxfs_extent_btree_initialize(
-		     &extent_btree,
+		     &( inode->data_extent_btree ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data extents B+ tree.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsxfs_extent_btree_get_extents_from_root_node(
-		     extent_btree,
-		     io_handle,
-		     file_io_handle,
-		     number_of_blocks,
-		     &( inode->data[ inode->data_fork_offset ] ),
-		     inode->data_fork_size,
-		     inode->data_extents_array,
-		     add_sparse_extents,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data extents from extent B+ tree.",
+			 "%s: unable to create data extent B+ tree.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfsxfs_extent_btree_free(
-		     &extent_btree,
-		     error ) != 1 )
+		/* Reading the data extents of a B+ tree requires all the nodes of
+		 * the B+ tree to be read, hence the data extents of a file are read
+		 * on demand. The data extents of a directory are read here since
+		 * they are needed to read the directory entries.
+		 */
+		if( add_sparse_extents == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data extents B+ tree.",
-			 function );
+			if( libfsxfs_inode_read_data_extents(
+			     inode,
+			     io_handle,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data extents.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 	}
 	if( inode->attributes_fork_size > 0 )
@@ -1476,9 +1959,8 @@ int libfsxfs_inode_read_file_io_handle(
 		else if( ( inode->attributes_fork_type == LIBFSXFS_FORK_TYPE_EXTENTS )
 		      && ( inode->number_of_attributes_extents > 0 ) )
 		{
-			if( libcdata_array_initialize(
+			if( libfsxfs_extent_array_initialize(
 			     &( inode->attributes_extents_array ),
-			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1511,9 +1993,8 @@ int libfsxfs_inode_read_file_io_handle(
 		}
 		else if( inode->attributes_fork_type == LIBFSXFS_FORK_TYPE_BTREE )
 		{
-			if( libcdata_array_initialize(
+			if( libfsxfs_extent_array_initialize(
 			     &( inode->attributes_extents_array ),
-			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1584,16 +2065,128 @@ on_error:
 	}
 	if( inode->attributes_extents_array != NULL )
 	{
-		libcdata_array_free(
+		libfsxfs_extent_array_free(
 		 &( inode->attributes_extents_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
 		 NULL );
 	}
+	if( inode->data_extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &( inode->data_extent_btree ),
+		 NULL );
+	}
+	if( inode->data_extents_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &( inode->data_extents_array ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the data extents from the data extent B+ tree
+ * The data extents are read only once, if the data extents array has
+ * been read before or the data fork is not a B+ tree this function does nothing
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsxfs_inode_read_data_extents";
+	uint64_t number_of_blocks  = 0;
+	uint8_t add_sparse_extents = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->data_extents_array != NULL )
+	 || ( inode->data_extent_btree == NULL ) )
+	{
+		return( 1 );
+	}
+	number_of_blocks = inode->size / io_handle->block_size;
+
+	if( ( inode->size % io_handle->block_size ) != 0 )
+	{
+		number_of_blocks++;
+	}
+	if( ( inode->file_mode & 0xf000 ) != LIBFSXFS_FILE_TYPE_DIRECTORY )
+	{
+		add_sparse_extents = 1;
+	}
+	if( libfsxfs_extent_array_initialize(
+	     &( inode->data_extents_array ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data extents array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_extent_btree_get_extents_from_root_node(
+	     inode->data_extent_btree,
+	     io_handle,
+	     file_io_handle,
+	     number_of_blocks,
+	     &( inode->data[ inode->data_fork_offset ] ),
+	     inode->data_fork_size,
+	     inode->data_extents_array,
+	     add_sparse_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extents from extent B+ tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
 	if( inode->data_extents_array != NULL )
 	{
-		libcdata_array_free(
+		libfsxfs_extent_array_free(
 		 &( inode->data_extents_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_extent_free,
 		 NULL );
 	}
 	return( -1 );
@@ -2056,7 +2649,7 @@ int libfsxfs_inode_get_number_of_data_extents(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libfsxfs_extent_array_get_number_of_extents(
 	     inode->data_extents_array,
 	     number_of_extents,
 	     error ) != 1 )
@@ -2095,10 +2688,10 @@ int libfsxfs_inode_get_data_extent_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libfsxfs_extent_array_get_extent_by_index(
 	     inode->data_extents_array,
 	     extent_index,
-	     (intptr_t **) extent,
+	     extent,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2114,6 +2707,239 @@ int libfsxfs_inode_get_data_extent_by_index(
 	return( 1 );
 }
 
+/* Retrieves the data extent that contains a specific logical block number
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_inode_get_data_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_get_data_extent_by_logical_block_number";
+	int result            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          inode->data_extents_array,
+	          logical_block_number,
+	          extent_index,
+	          extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extent for logical block number: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Looks up the data extent that contains a specific logical block number
+ * The data extent is retrieved from the data extents array if it has been read,
+ * otherwise only the nodes of the data extent B+ tree on the path to the logical
+ * block number are read. The extent values are copied into extent
+ * If no extent contains the logical block number, next_logical_block_number is
+ * set to the logical block number of the next extent or 0xffffffffffffffff
+ * if there is no next extent
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_inode_lookup_data_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t logical_block_number,
+     libfsxfs_extent_t *extent,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *array_extent = NULL;
+	static char *function           = "libfsxfs_inode_lookup_data_extent_by_logical_block_number";
+	int extent_index                = 0;
+	int number_of_extents           = 0;
+	int result                      = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_logical_block_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next logical block number.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode->data_extents_array == NULL )
+	 && ( inode->data_extent_btree != NULL ) )
+	{
+		result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+		          inode->data_extent_btree,
+		          io_handle,
+		          file_io_handle,
+		          &( inode->data[ inode->data_fork_offset ] ),
+		          inode->data_fork_size,
+		          logical_block_number,
+		          extent,
+		          next_logical_block_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data extent for logical block number: %" PRIu64 " from extent B+ tree.",
+			 function,
+			 logical_block_number );
+
+			return( -1 );
+		}
+		return( result );
+	}
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          inode->data_extents_array,
+	          logical_block_number,
+	          &extent_index,
+	          &array_extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data extent for logical block number: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libfsxfs_extent_array_get_number_of_extents(
+		     inode->data_extents_array,
+		     &number_of_extents,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data extents.",
+			 function );
+
+			return( -1 );
+		}
+		*next_logical_block_number = (uint64_t) 0xffffffffffffffffUL;
+
+		if( extent_index < number_of_extents )
+		{
+			if( libfsxfs_extent_array_get_extent_by_index(
+			     inode->data_extents_array,
+			     extent_index,
+			     &array_extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			if( array_extent == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data extent: %d.",
+				 function,
+				 extent_index );
+
+				return( -1 );
+			}
+			*next_logical_block_number = array_extent->logical_block_number;
+		}
+	}
+	else
+	{
+		if( array_extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data extent: %d.",
+			 function,
+			 extent_index );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     extent,
+		     array_extent,
+		     sizeof( libfsxfs_extent_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data extent.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
 /* Retrieves the number of attributes extents
  * Returns 1 if successful or -1 on error
  */
@@ -2135,7 +2961,7 @@ int libfsxfs_inode_get_number_of_attributes_extents(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libfsxfs_extent_array_get_number_of_extents(
 	     inode->attributes_extents_array,
 	     number_of_extents,
 	     error ) != 1 )
@@ -2174,10 +3000,10 @@ int libfsxfs_inode_get_attributes_extent_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libfsxfs_extent_array_get_extent_by_index(
 	     inode->attributes_extents_array,
 	     extent_index,
-	     (intptr_t **) extent,
+	     extent,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2193,3 +3019,49 @@ int libfsxfs_inode_get_attributes_extent_by_index(
 	return( 1 );
 }
 
+/* Retrieves the attributes extent that contains a specific logical block number
+ * Returns 1 if successful, 0 if no such extent or -1 on error
+ */
+int libfsxfs_inode_get_attributes_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_get_attributes_extent_by_logical_block_number";
+	int result            = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          inode->attributes_extents_array,
+	          logical_block_number,
+	          extent_index,
+	          extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attributes extent for logical block number: %" PRIu64 ".",
+		 function,
+		 logical_block_number );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -26,9 +26,10 @@
 #include <types.h>
 
 #include "libfsxfs_extent.h"
+#include "libfsxfs_extent_array.h"
+#include "libfsxfs_extent_btree.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
-#include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 
 #if defined( __cplusplus )
@@ -105,7 +106,12 @@ struct libfsxfs_inode
 
 	/* Data extents array
 	 */
-	libcdata_array_t *data_extents_array;
+	libfsxfs_extent_array_t *data_extents_array;
+
+	/* Data extent B+ tree, used to look up data extents on demand
+	 * before the data extents array has been read
+	 */
+	libfsxfs_extent_btree_t *data_extent_btree;
 
 	/* Data fork offset
 	 */
@@ -129,7 +135,7 @@ struct libfsxfs_inode
 
 	/* (Extended) attributes extents array
 	 */
-	libcdata_array_t *attributes_extents_array;
+	libfsxfs_extent_array_t *attributes_extents_array;
 
 	/* (Extended) attributes fork offset
 	 */
@@ -149,6 +155,16 @@ int libfsxfs_inode_free(
      libfsxfs_inode_t **inode,
      libcerror_error_t **error );
 
+int libfsxfs_inode_clone(
+     libfsxfs_inode_t **destination_inode,
+     libfsxfs_inode_t *source_inode,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_clone_attributes(
+     libfsxfs_inode_t **destination_inode,
+     libfsxfs_inode_t *source_inode,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_read_data(
      libfsxfs_inode_t *inode,
      libfsxfs_io_handle_t *io_handle,
@@ -163,6 +179,18 @@ int libfsxfs_inode_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int libfsxfs_inode_read_forks(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_read_data_extents(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_get_creation_time(
      libfsxfs_inode_t *inode,
      int64_t *posix_time,
@@ -230,6 +258,22 @@ int libfsxfs_inode_get_data_extent_by_index(
      libfsxfs_extent_t **extent,
      libcerror_error_t **error );
 
+int libfsxfs_inode_get_data_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_lookup_data_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t logical_block_number,
+     libfsxfs_extent_t *extent,
+     uint64_t *next_logical_block_number,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_get_number_of_attributes_extents(
      libfsxfs_inode_t *inode,
      int *number_of_extents,
@@ -241,6 +285,13 @@ int libfsxfs_inode_get_attributes_extent_by_index(
      libfsxfs_extent_t **extent,
      libcerror_error_t **error );
 
+int libfsxfs_inode_get_attributes_extent_by_logical_block_number(
+     libfsxfs_inode_t *inode,
+     uint64_t logical_block_number,
+     int *extent_index,
+     libfsxfs_extent_t **extent,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,6 +34,10 @@
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
+
+#include "fsxfs_btree.h"
 
 /* Creates an inode B+ tree
  * Make sure the value inode_btree is referencing, is set to NULL
@@ -114,11 +118,53 @@ int libfsxfs_inode_btree_initialize(
 
 		goto on_error;
 	}
+	if( libfcache_cache_initialize(
+	     &( ( *inode_btree )->blocks_cache ),
+	     LIBFSXFS_MAXIMUM_CACHE_ENTRIES_INODE_BTREE_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create blocks cache.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *inode_btree )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *inode_btree != NULL )
 	{
+		if( ( *inode_btree )->blocks_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( ( *inode_btree )->blocks_cache ),
+			 NULL );
+		}
+		if( ( *inode_btree )->inode_information_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *inode_btree )->inode_information_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *inode_btree );
 
@@ -150,6 +196,34 @@ int libfsxfs_inode_btree_free(
 	}
 	if( *inode_btree != NULL )
 	{
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *inode_btree )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libfcache_cache_free(
+		     &( ( *inode_btree )->blocks_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free blocks cache.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *inode_btree )->inode_information_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
@@ -172,19 +246,141 @@ int libfsxfs_inode_btree_free(
 	return( result );
 }
 
-/* Reads the inode information
+/* Sets the number of allocation groups
+ * The inode information of the allocation groups is read on demand, where
+ * inode_information_offset contains the offset of the inode information
+ * relative to the start of an allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     off64_t inode_information_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_btree_set_number_of_allocation_groups";
+	int result            = 1;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocation_groups == 0 )
+	 || ( number_of_allocation_groups > (uint32_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocation groups value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_information_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode information offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_empty(
+	     inode_btree->inode_information_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty inode information array.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_resize(
+	          inode_btree->inode_information_array,
+	          (int) number_of_allocation_groups,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_inode_information_free,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize inode information array.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		inode_btree->number_of_allocation_groups = number_of_allocation_groups;
+		inode_btree->inode_information_offset    = inode_information_offset;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the inode information of a specific allocation group
+ * The inode information is read without holding the read/write lock, if another
+ * thread stored the inode information in the meantime the inode information that
+ * was read is discarded
  * Returns 1 if successful or -1 on error
  */
 int libfsxfs_inode_btree_read_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t allocation_group_index,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_information_t *inode_information = NULL;
-	static char *function                           = "libfsxfs_file_system_read_inode_information";
-	int entry_index                                 = 0;
+	libfsxfs_inode_information_t *existing_inode_information = NULL;
+	libfsxfs_inode_information_t *inode_information          = NULL;
+	static char *function                                    = "libfsxfs_inode_btree_read_inode_information";
+	off64_t allocation_group_size                            = 0;
+	off64_t file_offset                                      = 0;
+	int result                                               = 1;
 
 	if( inode_btree == NULL )
 	{
@@ -197,6 +393,54 @@ int libfsxfs_inode_btree_read_inode_information(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= inode_btree->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_size = (off64_t) io_handle->allocation_group_size * io_handle->block_size;
+
+	if( ( allocation_group_size == 0 )
+	 || ( (off64_t) allocation_group_index > ( ( (off64_t) INT64_MAX - inode_btree->inode_information_offset ) / allocation_group_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode information offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = ( (off64_t) allocation_group_index * allocation_group_size ) + inode_btree->inode_information_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 allocation_group_index,
+		 file_offset,
+		 file_offset );
+	}
+#endif
 	if( libfsxfs_inode_information_initialize(
 	     &inode_information,
 	     error ) != 1 )
@@ -221,29 +465,100 @@ int libfsxfs_inode_btree_read_inode_information(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
+		 allocation_group_index,
 		 file_offset,
 		 file_offset );
 
 		goto on_error;
 	}
-	if( libcdata_array_append_entry(
-	     inode_btree->inode_information_array,
-	     &entry_index,
-	     (intptr_t *) inode_information,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append inode information to array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     (int) allocation_group_index,
+	     (intptr_t **) &existing_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+	else if( existing_inode_information == NULL )
+	{
+		if( libcdata_array_set_entry_by_index(
+		     inode_btree->inode_information_array,
+		     (int) allocation_group_index,
+		     (intptr_t *) inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inode information: %" PRIu32 " in array.",
+			 function,
+			 allocation_group_index );
+
+			result = -1;
+		}
+		else
+		{
+			inode_information = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( inode_information != NULL )
+	{
+		if( libfsxfs_inode_information_free(
+		     &inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode information.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
 
 on_error:
 	if( inode_information != NULL )
@@ -255,28 +570,202 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the inode from the inode B+ tree branch node
+/* Retrieves the stored inode information of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_btree_get_stored_inode_information(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_btree_get_stored_inode_information";
+	int result            = 1;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     inode_btree->inode_information_array,
+	     (int) allocation_group_index,
+	     (intptr_t **) inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the inode information of a specific allocation group
+ * The inode information is read on demand if not available
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_branch_node(
+int libfsxfs_inode_btree_get_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t allocation_group_block_number,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *safe_inode_information = NULL;
+	static char *function                                = "libfsxfs_inode_btree_get_inode_information";
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= inode_btree->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_btree_get_stored_inode_information(
+	     inode_btree,
+	     allocation_group_index,
+	     &safe_inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	if( safe_inode_information == NULL )
+	{
+		if( libfsxfs_inode_btree_read_inode_information(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     allocation_group_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+		if( libfsxfs_inode_btree_get_stored_inode_information(
+		     inode_btree,
+		     allocation_group_index,
+		     &safe_inode_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode information: %" PRIu32 ".",
+			 function,
+			 allocation_group_index );
+
+			return( -1 );
+		}
+	}
+	*inode_information = safe_inode_information;
+
+	return( 1 );
+}
+
+/* Retrieves the sub node that contains a specific inode from the inode B+ tree branch node
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_inode_btree_get_sub_node_from_branch_node(
+     libfsxfs_inode_btree_t *inode_btree,
      uint16_t number_of_records,
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t relative_inode_number,
-     int recursion_depth,
+     uint32_t *relative_sub_block_number,
      libcerror_error_t **error )
 {
-	static char *function              = "libfsxfs_inode_btree_get_inode_from_branch_node";
+	static char *function              = "libfsxfs_inode_btree_get_sub_node_from_branch_node";
 	size_t number_of_key_value_pairs   = 0;
 	size_t records_data_offset         = 0;
 	uint32_t relative_key_inode_number = 0;
-	uint32_t relative_sub_block_number = 0;
+	uint16_t middle_index              = 0;
 	uint16_t record_index              = 0;
-	int result                         = 0;
+	uint16_t upper_index               = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -312,14 +801,13 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	if( relative_sub_block_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid recursion depth value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative sub block number.",
 		 function );
 
 		return( -1 );
@@ -337,16 +825,22 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 
 		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	/* The keys are stored in ascending order, search for the number of keys
+	 * that are less or equal to the relative inode number
+	 */
+	record_index = 0;
+	upper_index  = number_of_records;
+
+	while( record_index < upper_index )
 	{
+		middle_index = record_index + ( ( upper_index - record_index ) / 2 );
+
+		records_data_offset = (size_t) middle_index * 4;
+
 		byte_stream_copy_to_uint32_big_endian(
 		 &( records_data[ records_data_offset ] ),
 		 relative_key_inode_number );
 
-		records_data_offset += 4;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -358,64 +852,48 @@ int libfsxfs_inode_btree_get_inode_from_branch_node(
 #endif
 		if( relative_inode_number < relative_key_inode_number )
 		{
-			break;
+			upper_index = middle_index;
+		}
+		else
+		{
+			record_index = middle_index + 1;
 		}
 	}
-	if( ( record_index > 0 )
-	 && ( record_index <= number_of_records ) )
+	if( ( record_index == 0 )
+	 || ( record_index > number_of_records ) )
 	{
-		records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
-
-		byte_stream_copy_to_uint32_big_endian(
-		 &( records_data[ records_data_offset ] ),
-		 relative_sub_block_number );
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			libcnotify_printf(
-			 "%s: sub block number\t: %" PRIu32 "\n",
-			 function,
-			 relative_sub_block_number );
-
 			libcnotify_printf(
 			 "\n" );
 		}
 #endif
-		result = libfsxfs_inode_btree_get_inode_from_node(
-		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
-		          relative_sub_block_number,
-		          relative_inode_number,
-		          recursion_depth + 1,
-		          error );
+		return( 0 );
+	}
+	records_data_offset = ( number_of_key_value_pairs + record_index - 1 ) * 4;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from node.",
-			 function );
+	byte_stream_copy_to_uint32_big_endian(
+	 &( records_data[ records_data_offset ] ),
+	 *relative_sub_block_number );
 
-			return( -1 );
-		}
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	else if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
 	{
+		libcnotify_printf(
+		 "%s: sub block number\t: %" PRIu32 "\n",
+		 function,
+		 *relative_sub_block_number );
+
 		libcnotify_printf(
 		 "\n" );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
 /* Retrieves the inode from the inode B+ tree leaf node
- * Returns 1 if successful or -1 on error
+ * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsxfs_inode_btree_get_inode_from_leaf_node(
      libfsxfs_inode_btree_t *inode_btree,
@@ -423,13 +901,16 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t inode_number,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
-	static char *function                             = "libfsxfs_inode_btree_get_inode_from_leaf_node";
-	size_t records_data_offset                        = 0;
-	uint16_t record_index                             = 0;
-	int result                                        = 0;
+	libfsxfs_inode_btree_record_t *safe_inode_btree_record = NULL;
+	static char *function                                  = "libfsxfs_inode_btree_get_inode_from_leaf_node";
+	size_t records_data_offset                             = 0;
+	uint32_t record_inode_number                           = 0;
+	uint16_t middle_index                                  = 0;
+	uint16_t record_index                                  = 0;
+	uint16_t upper_index                                   = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -465,6 +946,28 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 		return( -1 );
 	}
+	if( inode_btree_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_btree_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode B+ tree record value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( (size_t) number_of_records > ( records_data_size / 16 ) )
 	{
 		libcerror_error_set(
@@ -476,12 +979,39 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 		return( -1 );
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	/* The records are stored in ascending order, search for the last record
+	 * with a start inode number that is less or equal to the inode number
+	 */
+	record_index = 0;
+	upper_index  = number_of_records;
+
+	while( record_index < upper_index )
+	{
+		middle_index = record_index + ( ( upper_index - record_index ) / 2 );
+
+		records_data_offset = (size_t) middle_index * 16;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 ( (fsxfs_inode_btree_record_t *) &( records_data[ records_data_offset ] ) )->inode_number,
+		 record_inode_number );
+
+		if( inode_number < record_inode_number )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			record_index = middle_index + 1;
+		}
+	}
+	if( record_index > 0 )
 	{
+		record_index -= 1;
+
+		records_data_offset = (size_t) record_index * 16;
+
 		if( libfsxfs_inode_btree_record_initialize(
-		     &inode_btree_record,
+		     &safe_inode_btree_record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -495,7 +1025,7 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 			goto on_error;
 		}
 		if( libfsxfs_inode_btree_record_read_data(
-		     inode_btree_record,
+		     safe_inode_btree_record,
 		     &( records_data[ records_data_offset ] ),
 		     16,
 		     error ) != 1 )
@@ -510,17 +1040,18 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 			goto on_error;
 		}
-		records_data_offset += 16;
-
-		if( ( inode_number >= inode_btree_record->inode_number )
-		 && ( inode_number < ( inode_btree_record->inode_number + 64 ) ) )
+		if( ( inode_number >= safe_inode_btree_record->inode_number )
+		 && ( inode_number < ( (uint64_t) safe_inode_btree_record->inode_number + 64 ) ) )
 		{
-/* TODO check bitmap */
-			result = 1;
+			/* The chunk allocation bitmap is not checked so that unused inodes
+			 * can be retrieved as well
+			 */
+			*inode_btree_record = safe_inode_btree_record;
+
+			return( 1 );
 		}
-/* TODO cache records in block */
 		if( libfsxfs_inode_btree_record_free(
-		     &inode_btree_record,
+		     &safe_inode_btree_record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -533,41 +1064,34 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
 
 			goto on_error;
 		}
-		if( result != 0 )
-		{
-			break;
-		}
 	}
-	return( result );
+	return( 0 );
 
 on_error:
-	if( inode_btree_record != NULL )
+	if( safe_inode_btree_record != NULL )
 	{
 		libfsxfs_inode_btree_record_free(
-		 &inode_btree_record,
+		 &safe_inode_btree_record,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves the inode from the inode B+ tree node
+/* Reads an inode B+ tree block
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_inode_btree_get_inode_from_node(
+int libfsxfs_inode_btree_read_block(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t allocation_group_block_number,
-     uint64_t relative_block_number,
-     uint64_t relative_inode_number,
-     int recursion_depth,
+     uint64_t btree_block_number,
+     libfsxfs_btree_block_t **btree_block,
      libcerror_error_t **error )
 {
-	libfsxfs_btree_block_t *btree_block = NULL;
-	static char *function               = "libfsxfs_inode_btree_get_inode_from_node";
-	off64_t btree_block_offset          = 0;
-	int compare_result                  = 0;
-	int result                          = 0;
+	libfsxfs_btree_block_t *safe_btree_block = NULL;
+	static char *function                    = "libfsxfs_inode_btree_read_block";
+	off64_t btree_block_offset               = 0;
+	int compare_result                       = 0;
 
 	if( inode_btree == NULL )
 	{
@@ -602,32 +1126,32 @@ int libfsxfs_inode_btree_get_inode_from_node(
 
 		return( -1 );
 	}
-	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	if( btree_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid allocation group block number value out of bounds.",
+		 "%s: invalid B+ tree block number value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	if( btree_block == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid relative block number value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B+ tree block.",
 		 function );
 
 		return( -1 );
 	}
-	btree_block_offset = ( allocation_group_block_number + relative_block_number ) * io_handle->block_size;
+	btree_block_offset = (off64_t) btree_block_number * io_handle->block_size;
 
 	if( libfsxfs_btree_block_initialize(
-	     &btree_block,
+	     &safe_btree_block,
 	     io_handle->block_size,
 	     4,
 	     error ) != 1 )
@@ -642,7 +1166,7 @@ int libfsxfs_inode_btree_get_inode_from_node(
 		goto on_error;
 	}
 	if( libfsxfs_btree_block_read_file_io_handle(
-	     btree_block,
+	     safe_btree_block,
 	     io_handle,
 	     file_io_handle,
 	     btree_block_offset,
@@ -652,9 +1176,9 @@ int libfsxfs_inode_btree_get_inode_from_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode B+ tree block: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 "%s: unable to read inode B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 relative_block_number,
+		 btree_block_number,
 		 btree_block_offset,
 		 btree_block_offset );
 
@@ -663,14 +1187,14 @@ int libfsxfs_inode_btree_get_inode_from_node(
 	if( io_handle->format_version == 5 )
 	{
 		compare_result = memory_compare(
-		                  btree_block->header->signature,
+		                  safe_btree_block->header->signature,
 		                  "IAB3",
 		                  4 );
 	}
 	else
 	{
 		compare_result = memory_compare(
-		                  btree_block->header->signature,
+		                  safe_btree_block->header->signature,
 		                  "IABT",
 		                  4 );
 	}
@@ -685,6 +1209,283 @@ int libfsxfs_inode_btree_get_inode_from_node(
 
 		goto on_error;
 	}
+	*btree_block = safe_btree_block;
+
+	return( 1 );
+
+on_error:
+	if( safe_btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &safe_btree_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode from the inode B+ tree node
+ * The B+ tree blocks cache is only accessed while holding the read/write lock,
+ * blocks that are not cached are read without holding the lock. The sub node of
+ * a branch node is retrieved after the lock has been released
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsxfs_inode_btree_get_inode_from_node(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t allocation_group_block_number,
+     uint64_t relative_block_number,
+     uint64_t relative_inode_number,
+     int recursion_depth,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
+     libcerror_error_t **error )
+{
+	libfcache_cache_value_t *cache_value     = NULL;
+	libfsxfs_btree_block_t *btree_block      = NULL;
+	libfsxfs_btree_block_t *safe_btree_block = NULL;
+	static char *function                    = "libfsxfs_inode_btree_get_inode_from_node";
+	uint64_t btree_block_number              = 0;
+	uint32_t relative_sub_block_number       = 0;
+	uint16_t node_level                      = 0;
+	int result                               = 0;
+
+	if( inode_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode B+ tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_block_number > (uint64_t) ( INT64_MAX / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / io_handle->block_size ) - allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBFSXFS_MAXIMUM_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	btree_block_number = allocation_group_block_number + relative_block_number;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     inode_btree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The blocks are cached by their absolute block number, which contains
+	 * both the allocation group and the relative block number
+	 */
+	result = libfcache_cache_get_value_by_identifier(
+	          inode_btree->blocks_cache,
+	          0,
+	          (off64_t) btree_block_number,
+	          0,
+	          &cache_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The block is read without holding the lock so that lookups by other
+		 * threads are not blocked by the IO
+		 */
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     inode_btree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( libfsxfs_inode_btree_read_block(
+		     inode_btree,
+		     io_handle,
+		     file_io_handle,
+		     btree_block_number,
+		     &safe_btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode B+ tree block: %" PRIu64 ".",
+			 function,
+			 relative_block_number );
+
+			return( -1 );
+		}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     inode_btree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			libfsxfs_btree_block_free(
+			 &safe_btree_block,
+			 NULL );
+
+			return( -1 );
+		}
+#endif
+		/* Another thread could have cached the block while it was being read
+		 */
+		result = libfcache_cache_get_value_by_identifier(
+		          inode_btree->blocks_cache,
+		          0,
+		          (off64_t) btree_block_number,
+		          0,
+		          &cache_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value from cache.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libfcache_cache_set_value_by_identifier(
+			     inode_btree->blocks_cache,
+			     0,
+			     (off64_t) btree_block_number,
+			     0,
+			     (intptr_t *) safe_btree_block,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_btree_block_free,
+			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set B+ tree block in cache.",
+				 function );
+
+				goto on_error;
+			}
+			btree_block      = safe_btree_block;
+			safe_btree_block = NULL;
+		}
+	}
+	if( btree_block == NULL )
+	{
+		if( libfcache_cache_value_get_value(
+		     cache_value,
+		     (intptr_t **) &btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B+ tree block from cache value.",
+			 function );
+
+			goto on_error;
+		}
+		if( btree_block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing B+ tree block.",
+			 function );
+
+			goto on_error;
+		}
+	}
 /* TODO
 	if( btree_block->header->level > inode_btree->maximum_depth )
 	{
@@ -698,7 +1499,12 @@ int libfsxfs_inode_btree_get_inode_from_node(
 		goto on_error;
 	}
 */
-	if( btree_block->header->level == 0 )
+	/* The B+ tree block is managed by the cache and therefore is only parsed
+	 * while holding the lock
+	 */
+	node_level = btree_block->header->level;
+
+	if( node_level == 0 )
 	{
 		result = libfsxfs_inode_btree_get_inode_from_leaf_node(
 		          inode_btree,
@@ -706,6 +1512,7 @@ int libfsxfs_inode_btree_get_inode_from_node(
 		          btree_block->records_data,
 		          btree_block->records_data_size,
 		          relative_inode_number,
+		          inode_btree_record,
 		          error );
 
 		if( result == -1 )
@@ -722,16 +1529,13 @@ int libfsxfs_inode_btree_get_inode_from_node(
 	}
 	else
 	{
-		result = libfsxfs_inode_btree_get_inode_from_branch_node(
+		result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
 		          inode_btree,
-		          io_handle,
-		          file_io_handle,
-		          allocation_group_block_number,
 		          btree_block->header->number_of_records,
 		          btree_block->records_data,
 		          btree_block->records_data_size,
 		          relative_inode_number,
-		          recursion_depth,
+		          &relative_sub_block_number,
 		          error );
 
 		if( result == -1 )
@@ -740,38 +1544,110 @@ int libfsxfs_inode_btree_get_inode_from_node(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode from branch node.",
+			 "%s: unable to retrieve sub node from branch node.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libfsxfs_btree_block_free(
-	     &btree_block,
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     inode_btree->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free B+ tree block.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		if( safe_btree_block != NULL )
+		{
+			libfsxfs_btree_block_free(
+			 &safe_btree_block,
+			 NULL );
+		}
+		if( inode_btree_record != NULL )
+		{
+			libfsxfs_inode_btree_record_free(
+			 inode_btree_record,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	/* Free the block that was cached by another thread
+	 */
+	if( safe_btree_block != NULL )
+	{
+		if( libfsxfs_btree_block_free(
+		     &safe_btree_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B+ tree block.",
+			 function );
+
+			if( inode_btree_record != NULL )
+			{
+				libfsxfs_inode_btree_record_free(
+				 inode_btree_record,
+				 NULL );
+			}
+			return( -1 );
+		}
+	}
+	if( ( node_level != 0 )
+	 && ( result != 0 ) )
+	{
+		result = libfsxfs_inode_btree_get_inode_from_node(
+		          inode_btree,
+		          io_handle,
+		          file_io_handle,
+		          allocation_group_block_number,
+		          relative_sub_block_number,
+		          relative_inode_number,
+		          recursion_depth + 1,
+		          inode_btree_record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from sub node: %" PRIu32 ".",
+			 function,
+			 relative_sub_block_number );
+
+			return( -1 );
+		}
 	}
 	return( result );
 
 on_error:
-	if( btree_block != NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 inode_btree->read_write_lock,
+	 NULL );
+#endif
+	if( safe_btree_block != NULL )
 	{
 		libfsxfs_btree_block_free(
-		 &btree_block,
+		 &safe_btree_block,
 		 NULL );
 	}
 	return( -1 );
 }
 
 /* Retrieves a specific inode from the inode B+ tree
+ * If successful inode_btree_record contains the record of the inode chunk
+ * that contains the inode, which needs to be freed by the caller
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
 int libfsxfs_inode_btree_get_inode_by_number(
@@ -780,13 +1656,14 @@ int libfsxfs_inode_btree_get_inode_by_number(
      libbfio_handle_t *file_io_handle,
      uint64_t absolute_inode_number,
      off64_t *file_offset,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
      libcerror_error_t **error )
 {
 	libfsxfs_inode_information_t *inode_information = NULL;
 	static char *function                           = "libfsxfs_inode_btree_get_inode_by_number";
 	uint64_t allocation_group_block_number          = 0;
 	uint64_t relative_inode_number                  = 0;
-	int allocation_group_index                      = 0;
+	uint32_t allocation_group_index                 = 0;
 	int result                                      = 0;
 
 	if( inode_btree == NULL )
@@ -844,14 +1721,25 @@ int libfsxfs_inode_btree_get_inode_by_number(
 
 		return( -1 );
 	}
-	allocation_group_index = (int) ( absolute_inode_number >> io_handle->number_of_relative_inode_number_bits );
+	if( ( absolute_inode_number >> io_handle->number_of_relative_inode_number_bits ) >= (uint64_t) inode_btree->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid absolute inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	allocation_group_index = (uint32_t) ( absolute_inode_number >> io_handle->number_of_relative_inode_number_bits );
 	relative_inode_number  = absolute_inode_number & ( ( (uint64_t) 1 << io_handle->number_of_relative_inode_number_bits ) - 1 );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: allocation group index\t: %d\n",
+		 "%s: allocation group index\t: %" PRIu32 "\n",
 		 function,
 		 allocation_group_index );
 
@@ -865,17 +1753,19 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libcdata_array_get_entry_by_index(
-	     inode_btree->inode_information_array,
+	if( libfsxfs_inode_btree_get_inode_information(
+	     inode_btree,
+	     io_handle,
+	     file_io_handle,
 	     allocation_group_index,
-	     (intptr_t **) &inode_information,
+	     &inode_information,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode information: %d.",
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
 		 function,
 		 allocation_group_index );
 
@@ -902,6 +1792,7 @@ int libfsxfs_inode_btree_get_inode_by_number(
 	          inode_information->inode_btree_root_block_number,
 	          relative_inode_number,
 	          0,
+	          inode_btree_record,
 	          error );
 
 	if( result == -1 )
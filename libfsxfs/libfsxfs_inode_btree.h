@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsxfs_btree_block.h"
 #include "libfsxfs_inode_btree_record.h"
 #include "libfsxfs_inode_information.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libbfio.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_libfcache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -43,6 +46,24 @@ struct libfsxfs_inode_btree
 	/* Inode information array
 	 */
 	libcdata_array_t *inode_information_array;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The offset of the inode information relative to the start of an allocation group
+	 */
+	off64_t inode_information_offset;
+
+	/* The B+ tree blocks cache
+	 */
+	libfcache_cache_t *blocks_cache;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsxfs_inode_btree_initialize(
@@ -53,23 +74,40 @@ int libfsxfs_inode_btree_free(
      libfsxfs_inode_btree_t **inode_btree,
      libcerror_error_t **error );
 
+int libfsxfs_inode_btree_set_number_of_allocation_groups(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t number_of_allocation_groups,
+     off64_t inode_information_offset,
+     libcerror_error_t **error );
+
 int libfsxfs_inode_btree_read_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     uint32_t allocation_group_index,
      libcerror_error_t **error );
 
-int libfsxfs_inode_btree_get_inode_from_branch_node(
+int libfsxfs_inode_btree_get_stored_inode_information(
+     libfsxfs_inode_btree_t *inode_btree,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_inode_information(
      libfsxfs_inode_btree_t *inode_btree,
      libfsxfs_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     uint64_t allocation_group_block_number,
+     uint32_t allocation_group_index,
+     libfsxfs_inode_information_t **inode_information,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_get_sub_node_from_branch_node(
+     libfsxfs_inode_btree_t *inode_btree,
      uint16_t number_of_records,
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t relative_inode_number,
-     int recursion_depth,
+     uint32_t *relative_sub_block_number,
      libcerror_error_t **error );
 
 int libfsxfs_inode_btree_get_inode_from_leaf_node(
@@ -78,6 +116,15 @@ int libfsxfs_inode_btree_get_inode_from_leaf_node(
      const uint8_t *records_data,
      size_t records_data_size,
      uint64_t relative_inode_number,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_btree_read_block(
+     libfsxfs_inode_btree_t *inode_btree,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t btree_block_number,
+     libfsxfs_btree_block_t **btree_block,
      libcerror_error_t **error );
 
 int libfsxfs_inode_btree_get_inode_from_node(
@@ -88,6 +135,7 @@ int libfsxfs_inode_btree_get_inode_from_node(
      uint64_t relative_block_number,
      uint64_t relative_inode_number,
      int recursion_depth,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
      libcerror_error_t **error );
 
 int libfsxfs_inode_btree_get_inode_by_number(
@@ -96,6 +144,7 @@ int libfsxfs_inode_btree_get_inode_by_number(
      libbfio_handle_t *file_io_handle,
      uint64_t absolute_inode_number,
      off64_t *file_offset,
+     libfsxfs_inode_btree_record_t **inode_btree_record,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -426,10 +426,12 @@ int libfsxfs_inode_information_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	uint8_t data[ 512 ];
+	uint8_t buffer[ 512 ];
 
 	static char *function = "libfsxfs_inode_information_read_file_io_handle";
+	const uint8_t *data   = NULL;
 	ssize_t read_count    = 0;
+	int result            = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -441,26 +443,50 @@ int libfsxfs_inode_information_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              data,
-	              512,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) 512 )
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          file_offset,
+	          512,
+	          &data,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
 		 file_offset,
 		 file_offset );
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              512,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) 512 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode information at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		data = buffer;
+	}
 	if( libfsxfs_inode_information_read_data(
 	     inode_information,
 	     io_handle,
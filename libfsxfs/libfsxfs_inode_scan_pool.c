@@ -0,0 +1,1599 @@
+/*
+ * Inode scan pool functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_scan_pool.h"
+#include "libfsxfs_inode_scanner.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+/* Creates an inode scan worker
+ * Make sure the value scan_worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_worker_initialize(
+     libfsxfs_inode_scan_worker_t **scan_worker,
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scan_worker_initialize";
+	int result            = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scan worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_worker = memory_allocate_structure(
+	                libfsxfs_inode_scan_worker_t );
+
+	if( *scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode scan worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_worker,
+	     0,
+	     sizeof( libfsxfs_inode_scan_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode scan worker.",
+		 function );
+
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+
+		return( -1 );
+	}
+	/* Every worker reads using its own file IO handle
+	 */
+	if( libbfio_handle_clone(
+	     &( ( *scan_worker )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *scan_worker )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *scan_worker )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		( *scan_worker )->file_io_handle_opened_in_worker = 1;
+	}
+	if( libfsxfs_inode_scanner_initialize(
+	     &( ( *scan_worker )->inode_scanner ),
+	     scan_pool->io_handle,
+	     ( *scan_worker )->file_io_handle,
+	     file_system,
+	     scan_pool->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_worker )->inodes = (libfsxfs_inode_t **) memory_allocate(
+	                                                  sizeof( libfsxfs_inode_t * ) * LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES );
+
+	if( ( *scan_worker )->inodes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inodes.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_worker )->inode_numbers = (uint64_t *) memory_allocate(
+	                                                sizeof( uint64_t ) * LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES );
+
+	if( ( *scan_worker )->inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode numbers.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_worker )->scan_pool = scan_pool;
+	( *scan_worker )->result    = 1;
+
+	return( 1 );
+
+on_error:
+	if( *scan_worker != NULL )
+	{
+		libfsxfs_inode_scan_worker_free(
+		 scan_worker,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an inode scan worker
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_worker_free(
+     libfsxfs_inode_scan_worker_t **scan_worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scan_worker_free";
+	int value_index       = 0;
+	int result            = 1;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_worker != NULL )
+	{
+		if( ( *scan_worker )->inodes != NULL )
+		{
+			/* Free the inodes that were not delivered
+			 */
+			while( ( *scan_worker )->number_of_values > 0 )
+			{
+				value_index = ( *scan_worker )->first_value_index;
+
+				if( libfsxfs_inode_free(
+				     &( ( *scan_worker )->inodes[ value_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free inode.",
+					 function );
+
+					result = -1;
+				}
+				( *scan_worker )->first_value_index = ( value_index + 1 ) % LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES;
+				( *scan_worker )->number_of_values -= 1;
+			}
+			memory_free(
+			 ( *scan_worker )->inodes );
+		}
+		if( ( *scan_worker )->inode_numbers != NULL )
+		{
+			memory_free(
+			 ( *scan_worker )->inode_numbers );
+		}
+		if( ( *scan_worker )->inode_scanner != NULL )
+		{
+			if( libfsxfs_inode_scanner_close(
+			     &( ( *scan_worker )->inode_scanner ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode scanner.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->file_io_handle != NULL )
+		{
+			if( ( *scan_worker )->file_io_handle_opened_in_worker != 0 )
+			{
+				if( libbfio_handle_close(
+				     ( *scan_worker )->file_io_handle,
+				     error ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+					 "%s: unable to close file IO handle.",
+					 function );
+
+					result = -1;
+				}
+			}
+			if( libbfio_handle_free(
+			     &( ( *scan_worker )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_worker )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *scan_worker )->error ) );
+		}
+		memory_free(
+		 *scan_worker );
+
+		*scan_worker = NULL;
+	}
+	return( result );
+}
+
+/* Scans the allocation group assigned to the inode scan worker
+ * The inodes are added to the values of the worker for delivery
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_worker_scan_allocation_group(
+     libfsxfs_inode_scan_worker_t *scan_worker,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_scan_pool_t *scan_pool = NULL;
+	libfsxfs_inode_t *inode               = NULL;
+	static char *function                 = "libfsxfs_inode_scan_worker_scan_allocation_group";
+	uint64_t inode_number                 = 0;
+	int value_index                       = 0;
+	int result                            = 0;
+
+	if( scan_worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_worker->scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scan worker - missing inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	scan_pool = scan_worker->scan_pool;
+
+	if( libfsxfs_internal_inode_scanner_set_allocation_group(
+	     (libfsxfs_internal_inode_scanner_t *) scan_worker->inode_scanner,
+	     scan_worker->allocation_group_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set allocation group: %" PRIu32 " in inode scanner.",
+		 function,
+		 scan_worker->allocation_group_index );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libfsxfs_inode_scanner_get_next_inode(
+		          scan_worker->inode_scanner,
+		          &inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next inode from allocation group: %" PRIu32 ".",
+			 function,
+			 scan_worker->allocation_group_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libfsxfs_internal_inode_scanner_take_inode(
+		     (libfsxfs_internal_inode_scanner_t *) scan_worker->inode_scanner,
+		     &inode_number,
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to take inode: %" PRIu64 " from inode scanner.",
+			 function,
+			 inode_number );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_grab(
+		     scan_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		while( ( scan_pool->abort == 0 )
+		    && ( scan_worker->number_of_values >= LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES ) )
+		{
+			if( libcthreads_condition_wait(
+			     scan_pool->values_delivered_condition,
+			     scan_pool->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for values delivered condition.",
+				 function );
+
+				goto on_error_with_mutex;
+			}
+		}
+		if( scan_pool->abort != 0 )
+		{
+			result = 0;
+		}
+		else
+		{
+			value_index = ( scan_worker->first_value_index + scan_worker->number_of_values ) % LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES;
+
+			scan_worker->inodes[ value_index ]        = inode;
+			scan_worker->inode_numbers[ value_index ] = inode_number;
+			scan_worker->number_of_values            += 1;
+
+			inode = NULL;
+
+			if( libcthreads_condition_broadcast(
+			     scan_pool->values_available_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast values available condition.",
+				 function );
+
+				goto on_error_with_mutex;
+			}
+		}
+		if( libcthreads_mutex_release(
+		     scan_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result != 0 );
+
+	if( inode != NULL )
+	{
+		/* The scan was aborted before the inode could be delivered
+		 */
+		if( libfsxfs_inode_free(
+		     &inode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	scan_worker->allocation_group_is_finished = 1;
+
+	if( libcthreads_condition_broadcast(
+	     scan_pool->values_available_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast values available condition.",
+		 function );
+
+		goto on_error_with_mutex;
+	}
+	if( libcthreads_mutex_release(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error_with_mutex:
+	libcthreads_mutex_release(
+	 scan_pool->mutex,
+	 NULL );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs an inode scan worker
+ * This function is the thread callback function of the worker
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_worker_run(
+     void *arguments )
+{
+	libfsxfs_inode_scan_pool_t *scan_pool     = NULL;
+	libfsxfs_inode_scan_worker_t *scan_worker = NULL;
+	static char *function                     = "libfsxfs_inode_scan_worker_run";
+	int result                                = 1;
+
+	scan_worker = (libfsxfs_inode_scan_worker_t *) arguments;
+
+	if( scan_worker == NULL )
+	{
+		return( -1 );
+	}
+	scan_pool = scan_worker->scan_pool;
+
+	if( scan_pool == NULL )
+	{
+		return( -1 );
+	}
+	while( result == 1 )
+	{
+		if( libcthreads_mutex_grab(
+		     scan_pool->mutex,
+		     &( scan_worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( scan_worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		/* When delivering in inode number order the worker waits for all inodes
+		 * of its previous allocation group to be delivered
+		 */
+		while( ( scan_pool->abort == 0 )
+		    && ( ( scan_pool->scan_flags & LIBFSXFS_INODE_SCAN_FLAG_ORDERED ) != 0 )
+		    && ( scan_worker->allocation_group_is_set != 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     scan_pool->values_delivered_condition,
+			     scan_pool->mutex,
+			     &( scan_worker->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( scan_worker->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for values delivered condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( ( result != 1 )
+		 || ( scan_pool->abort != 0 )
+		 || ( scan_pool->next_allocation_group_index >= scan_pool->number_of_allocation_groups ) )
+		{
+			libcthreads_mutex_release(
+			 scan_pool->mutex,
+			 NULL );
+
+			break;
+		}
+		scan_worker->allocation_group_index       = scan_pool->next_allocation_group_index;
+		scan_worker->allocation_group_is_set      = 1;
+		scan_worker->allocation_group_is_finished = 0;
+
+		scan_pool->next_allocation_group_index += 1;
+
+		if( libcthreads_condition_broadcast(
+		     scan_pool->values_available_condition,
+		     &( scan_worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( scan_worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast values available condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_release(
+		     scan_pool->mutex,
+		     &( scan_worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( scan_worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( result != 1 )
+		{
+			break;
+		}
+		if( libfsxfs_inode_scan_worker_scan_allocation_group(
+		     scan_worker,
+		     &( scan_worker->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( scan_worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan allocation group: %" PRIu32 ".",
+			 function,
+			 scan_worker->allocation_group_index );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     scan_pool->mutex,
+	     NULL ) == 1 )
+	{
+		if( result != 1 )
+		{
+			scan_pool->abort = 1;
+		}
+		scan_pool->number_of_active_workers -= 1;
+
+		libcthreads_condition_broadcast(
+		 scan_pool->values_available_condition,
+		 NULL );
+
+		libcthreads_condition_broadcast(
+		 scan_pool->values_delivered_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 scan_pool->mutex,
+		 NULL );
+	}
+	scan_worker->result = result;
+
+	return( result );
+}
+
+/* Creates an inode scan pool
+ * Make sure the value scan_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_pool_initialize(
+     libfsxfs_inode_scan_pool_t **scan_pool,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     uint8_t scan_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scan_pool_initialize";
+	int number_of_workers = 0;
+	int worker_index      = 0;
+
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scan pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocation_groups == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of allocation groups value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_flags & ~( LIBFSXFS_INODE_SCAN_FLAG_ORDERED ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan flags: 0x%02" PRIx8 ".",
+		 function,
+		 scan_flags );
+
+		return( -1 );
+	}
+	/* There is no use for more workers than allocation groups
+	 */
+	number_of_workers = number_of_threads;
+
+	if( (uint32_t) number_of_workers > number_of_allocation_groups )
+	{
+		number_of_workers = (int) number_of_allocation_groups;
+	}
+	*scan_pool = memory_allocate_structure(
+	              libfsxfs_inode_scan_pool_t );
+
+	if( *scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode scan pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_pool,
+	     0,
+	     sizeof( libfsxfs_inode_scan_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode scan pool.",
+		 function );
+
+		memory_free(
+		 *scan_pool );
+
+		*scan_pool = NULL;
+
+		return( -1 );
+	}
+	( *scan_pool )->io_handle                   = io_handle;
+	( *scan_pool )->number_of_allocation_groups = number_of_allocation_groups;
+	( *scan_pool )->scan_flags                  = scan_flags;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *scan_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scan_pool )->values_available_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values available condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scan_pool )->values_delivered_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values delivered condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_scanner_initialize(
+	     &( ( *scan_pool )->delivery_inode_scanner ),
+	     io_handle,
+	     file_io_handle,
+	     file_system,
+	     number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create delivery inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_pool )->workers = (libfsxfs_inode_scan_worker_t **) memory_allocate(
+	                                                             sizeof( libfsxfs_inode_scan_worker_t * ) * number_of_workers );
+
+	if( ( *scan_pool )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scan_pool )->workers,
+	     0,
+	     sizeof( libfsxfs_inode_scan_worker_t * ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_pool )->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libfsxfs_inode_scan_worker_initialize(
+		     &( ( *scan_pool )->workers[ worker_index ] ),
+		     *scan_pool,
+		     file_system,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_pool != NULL )
+	{
+		libfsxfs_inode_scan_pool_free(
+		 scan_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an inode scan pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_pool_free(
+     libfsxfs_inode_scan_pool_t **scan_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scan_pool_free";
+	int worker_index      = 0;
+	int result            = 1;
+
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_pool != NULL )
+	{
+		if( ( *scan_pool )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *scan_pool )->number_of_workers;
+			     worker_index++ )
+			{
+				if( libfsxfs_inode_scan_worker_free(
+				     &( ( *scan_pool )->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *scan_pool )->workers );
+		}
+		if( ( *scan_pool )->delivery_inode_scanner != NULL )
+		{
+			if( libfsxfs_inode_scanner_close(
+			     &( ( *scan_pool )->delivery_inode_scanner ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free delivery inode scanner.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_pool )->values_delivered_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *scan_pool )->values_delivered_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free values delivered condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_pool )->values_available_condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *scan_pool )->values_available_condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free values available condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scan_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *scan_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *scan_pool );
+
+		*scan_pool = NULL;
+	}
+	return( result );
+}
+
+/* Aborts the scan and wakes up the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_pool_abort(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_inode_scan_pool_abort";
+	int result            = 1;
+
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	scan_pool->abort = 1;
+
+	if( libcthreads_condition_broadcast(
+	     scan_pool->values_delivered_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast values delivered condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next inode delivered by the workers
+ * This function blocks until an inode is available
+ * Returns 1 if successful, 0 if there are no more inodes or -1 on error
+ */
+int libfsxfs_inode_scan_pool_get_next_inode(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     uint64_t *inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_scan_worker_t *scan_worker = NULL;
+	static char *function                     = "libfsxfs_inode_scan_pool_get_next_inode";
+	int value_index                           = 0;
+	int worker_index                          = 0;
+	int result                                = 0;
+
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( scan_pool->abort == 0 )
+	{
+		scan_worker = NULL;
+
+		if( ( scan_pool->scan_flags & LIBFSXFS_INODE_SCAN_FLAG_ORDERED ) != 0 )
+		{
+			if( scan_pool->delivery_allocation_group_index >= scan_pool->number_of_allocation_groups )
+			{
+				break;
+			}
+			/* Deliver the inodes of the allocation group with the lowest index first
+			 */
+			for( worker_index = 0;
+			     worker_index < scan_pool->number_of_workers;
+			     worker_index++ )
+			{
+				if( ( scan_pool->workers[ worker_index ]->allocation_group_is_set != 0 )
+				 && ( scan_pool->workers[ worker_index ]->allocation_group_index == scan_pool->delivery_allocation_group_index ) )
+				{
+					scan_worker = scan_pool->workers[ worker_index ];
+
+					break;
+				}
+			}
+			if( ( scan_worker != NULL )
+			 && ( scan_worker->number_of_values == 0 )
+			 && ( scan_worker->allocation_group_is_finished != 0 ) )
+			{
+				scan_worker->allocation_group_is_set       = 0;
+				scan_pool->delivery_allocation_group_index += 1;
+
+				if( libcthreads_condition_broadcast(
+				     scan_pool->values_delivered_condition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to broadcast values delivered condition.",
+					 function );
+
+					goto on_error;
+				}
+				continue;
+			}
+		}
+		else
+		{
+			for( worker_index = 0;
+			     worker_index < scan_pool->number_of_workers;
+			     worker_index++ )
+			{
+				scan_pool->delivery_worker_index %= scan_pool->number_of_workers;
+
+				if( scan_pool->workers[ scan_pool->delivery_worker_index ]->number_of_values > 0 )
+				{
+					scan_worker = scan_pool->workers[ scan_pool->delivery_worker_index ];
+
+					break;
+				}
+				scan_pool->delivery_worker_index += 1;
+			}
+		}
+		if( ( scan_worker != NULL )
+		 && ( scan_worker->number_of_values > 0 ) )
+		{
+			value_index = scan_worker->first_value_index;
+
+			*inode_number = scan_worker->inode_numbers[ value_index ];
+			*inode        = scan_worker->inodes[ value_index ];
+
+			scan_worker->inodes[ value_index ] = NULL;
+			scan_worker->first_value_index     = ( value_index + 1 ) % LIBFSXFS_MAXIMUM_NUMBER_OF_INODE_SCAN_VALUES;
+			scan_worker->number_of_values     -= 1;
+
+			if( libcthreads_condition_broadcast(
+			     scan_pool->values_delivered_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast values delivered condition.",
+				 function );
+
+				goto on_error;
+			}
+			result = 1;
+
+			break;
+		}
+		if( scan_pool->number_of_active_workers == 0 )
+		{
+			break;
+		}
+		if( libcthreads_condition_wait(
+		     scan_pool->values_available_condition,
+		     scan_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for values available condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     scan_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		if( *inode != NULL )
+		{
+			libfsxfs_inode_free(
+			 inode,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 scan_pool->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Runs the workers of the inode scan pool
+ * The callback function is called from the calling thread for every used inode
+ * with an inode scanner that provides access to the attributes of the inode
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scan_pool_run(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     int (*callback_function)(
+            libfsxfs_inode_scanner_t *inode_scanner,
+            uint64_t inode_number,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode     = NULL;
+	static char *function       = "libfsxfs_inode_scan_pool_run";
+	uint64_t inode_number       = 0;
+	int callback_result         = 0;
+	int number_of_threads       = 0;
+	int result                  = 1;
+	int worker_index            = 0;
+
+	if( scan_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scan pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	scan_pool->number_of_active_workers = scan_pool->number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < scan_pool->number_of_workers;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( scan_pool->workers[ worker_index ]->thread ),
+		     NULL,
+		     libfsxfs_inode_scan_worker_run,
+		     (void *) scan_pool->workers[ worker_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+
+			break;
+		}
+		number_of_threads++;
+	}
+	if( result == 1 )
+	{
+		do
+		{
+			callback_result = libfsxfs_inode_scan_pool_get_next_inode(
+			                   scan_pool,
+			                   &inode_number,
+			                   &inode,
+			                   error );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next inode.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			else if( callback_result == 0 )
+			{
+				break;
+			}
+			if( libfsxfs_internal_inode_scanner_set_inode(
+			     (libfsxfs_internal_inode_scanner_t *) scan_pool->delivery_inode_scanner,
+			     inode_number,
+			     &inode,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set inode: %" PRIu64 " in delivery inode scanner.",
+				 function,
+				 inode_number );
+
+				libfsxfs_inode_free(
+				 &inode,
+				 NULL );
+
+				result = -1;
+
+				break;
+			}
+			callback_result = callback_function(
+			                   scan_pool->delivery_inode_scanner,
+			                   inode_number,
+			                   callback_arguments );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				result = -1;
+			}
+		}
+		while( callback_result == 1 );
+	}
+	/* Wake up the workers that are waiting for inodes to be delivered
+	 */
+	if( libfsxfs_inode_scan_pool_abort(
+	     scan_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to abort workers.",
+		 function );
+
+		result = -1;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( scan_pool->workers[ worker_index ]->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_threads;
+	     worker_index++ )
+	{
+		if( scan_pool->workers[ worker_index ]->result != 1 )
+		{
+			if( result == 1 )
+			{
+				/* Chain the error of the first failed worker into the error of the caller
+				 */
+				if( ( error != NULL )
+				 && ( *error == NULL ) )
+				{
+					*error = scan_pool->workers[ worker_index ]->error;
+
+					scan_pool->workers[ worker_index ]->error = NULL;
+				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: worker: %d failed to scan allocation group: %" PRIu32 ".",
+				 function,
+				 worker_index,
+				 scan_pool->workers[ worker_index ]->allocation_group_index );
+
+				result = -1;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			else if( ( libcnotify_verbose != 0 )
+			      && ( scan_pool->workers[ worker_index ]->error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 scan_pool->workers[ worker_index ]->error );
+			}
+#endif
+		}
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
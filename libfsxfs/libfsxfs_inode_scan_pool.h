@@ -0,0 +1,222 @@
+/*
+ * Inode scan pool functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_SCAN_POOL_H )
+#define _LIBFSXFS_INODE_SCAN_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+
+typedef struct libfsxfs_inode_scan_pool libfsxfs_inode_scan_pool_t;
+typedef struct libfsxfs_inode_scan_worker libfsxfs_inode_scan_worker_t;
+
+struct libfsxfs_inode_scan_worker
+{
+	/* The inode scan pool
+	 */
+	libfsxfs_inode_scan_pool_t *scan_pool;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was opened by the worker
+	 */
+	uint8_t file_io_handle_opened_in_worker;
+
+	/* The inode scanner
+	 */
+	libfsxfs_inode_scanner_t *inode_scanner;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The index of the allocation group that is being scanned
+	 */
+	uint32_t allocation_group_index;
+
+	/* Value to indicate an allocation group is assigned to the worker
+	 */
+	uint8_t allocation_group_is_set;
+
+	/* Value to indicate the worker has finished scanning the allocation group
+	 */
+	uint8_t allocation_group_is_finished;
+
+	/* The inodes that have not been delivered
+	 */
+	libfsxfs_inode_t **inodes;
+
+	/* The inode numbers of the inodes that have not been delivered
+	 */
+	uint64_t *inode_numbers;
+
+	/* The index of the first inode that has not been delivered
+	 */
+	int first_value_index;
+
+	/* The number of inodes that have not been delivered
+	 */
+	int number_of_values;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+
+	/* The result of the worker
+	 */
+	int result;
+};
+
+struct libfsxfs_inode_scan_pool
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The index of the next allocation group to assign to a worker
+	 */
+	uint32_t next_allocation_group_index;
+
+	/* The index of the allocation group of which inodes are delivered
+	 * in inode number order
+	 */
+	uint32_t delivery_allocation_group_index;
+
+	/* The scan flags
+	 */
+	uint8_t scan_flags;
+
+	/* The workers
+	 */
+	libfsxfs_inode_scan_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of workers that are still scanning
+	 */
+	int number_of_active_workers;
+
+	/* The index of the worker to deliver the next inode from
+	 */
+	int delivery_worker_index;
+
+	/* Value to indicate the scan should be aborted
+	 */
+	uint8_t abort;
+
+	/* The inode scanner used to deliver the inodes
+	 */
+	libfsxfs_inode_scanner_t *delivery_inode_scanner;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when inodes are available for delivery
+	 */
+	libcthreads_condition_t *values_available_condition;
+
+	/* The condition that is signalled when inodes were delivered
+	 */
+	libcthreads_condition_t *values_delivered_condition;
+};
+
+int libfsxfs_inode_scan_worker_initialize(
+     libfsxfs_inode_scan_worker_t **scan_worker,
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     libfsxfs_file_system_t *file_system,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_worker_free(
+     libfsxfs_inode_scan_worker_t **scan_worker,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_worker_scan_allocation_group(
+     libfsxfs_inode_scan_worker_t *scan_worker,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_worker_run(
+     void *arguments );
+
+int libfsxfs_inode_scan_pool_initialize(
+     libfsxfs_inode_scan_pool_t **scan_pool,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     int number_of_threads,
+     uint8_t scan_flags,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_pool_free(
+     libfsxfs_inode_scan_pool_t **scan_pool,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_pool_abort(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_pool_get_next_inode(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     uint64_t *inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_inode_scan_pool_run(
+     libfsxfs_inode_scan_pool_t *scan_pool,
+     int (*callback_function)(
+            libfsxfs_inode_scanner_t *inode_scanner,
+            uint64_t inode_number,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_SCAN_POOL_H ) */
+
@@ -0,0 +1,2334 @@
+/*
+ * Inode scanner functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsxfs_attribute_values.h"
+#include "libfsxfs_attributes.h"
+#include "libfsxfs_btree_block.h"
+#include "libfsxfs_btree_header.h"
+#include "libfsxfs_definitions.h"
+#include "libfsxfs_extended_attribute.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_inode_information.h"
+#include "libfsxfs_inode_scanner.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcnotify.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#include "fsxfs_btree.h"
+
+/* Creates an inode scanner
+ * Make sure the value inode_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_initialize(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_initialize";
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->inode_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid IO handle - inode size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = memory_allocate_structure(
+	                          libfsxfs_internal_inode_scanner_t );
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_inode_scanner,
+	     0,
+	     sizeof( libfsxfs_internal_inode_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode scanner.",
+		 function );
+
+		memory_free(
+		 internal_inode_scanner );
+
+		return( -1 );
+	}
+	/* The chunk buffer is large enough to contain all the inodes of an inode chunk
+	 */
+	internal_inode_scanner->chunk_buffer = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * 64 * io_handle->inode_size );
+
+	if( internal_inode_scanner->chunk_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode chunk data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_initialize(
+	     &( internal_inode_scanner->inode ),
+	     io_handle->inode_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_inode_scanner->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_inode_scanner->io_handle                   = io_handle;
+	internal_inode_scanner->file_io_handle              = file_io_handle;
+	internal_inode_scanner->file_system                 = file_system;
+	internal_inode_scanner->number_of_allocation_groups = number_of_allocation_groups;
+	internal_inode_scanner->end_allocation_group_index  = number_of_allocation_groups;
+
+	*inode_scanner = (libfsxfs_inode_scanner_t *) internal_inode_scanner;
+
+	return( 1 );
+
+on_error:
+	if( internal_inode_scanner != NULL )
+	{
+		if( internal_inode_scanner->inode != NULL )
+		{
+			libfsxfs_inode_free(
+			 &( internal_inode_scanner->inode ),
+			 NULL );
+		}
+		if( internal_inode_scanner->chunk_buffer != NULL )
+		{
+			memory_free(
+			 internal_inode_scanner->chunk_buffer );
+		}
+		memory_free(
+		 internal_inode_scanner );
+	}
+	return( -1 );
+}
+
+/* Closes and frees an inode scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_close(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_close";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_scanner != NULL )
+	{
+		internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) *inode_scanner;
+		*inode_scanner         = NULL;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_inode_scanner->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( internal_inode_scanner->btree_block != NULL )
+		{
+			if( libfsxfs_btree_block_free(
+			     &( internal_inode_scanner->btree_block ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free B+ tree block.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libfsxfs_internal_inode_scanner_free_extended_attributes(
+		     internal_inode_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extended attributes.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsxfs_inode_free(
+		     &( internal_inode_scanner->inode ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_inode_scanner->chunk_buffer );
+
+		memory_free(
+		 internal_inode_scanner );
+	}
+	return( result );
+}
+
+/* Restricts the inode scanner to a specific allocation group
+ * Scanning restarts at the first inode of the allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_set_allocation_group(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_inode_scanner_set_allocation_group";
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocation_group_index >= internal_inode_scanner->number_of_allocation_groups )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid allocation group index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->btree_block != NULL )
+	{
+		if( libfsxfs_btree_block_free(
+		     &( internal_inode_scanner->btree_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B+ tree block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfsxfs_internal_inode_scanner_free_extended_attributes(
+	     internal_inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extended attributes.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner->allocation_group_index     = allocation_group_index;
+	internal_inode_scanner->end_allocation_group_index = allocation_group_index + 1;
+	internal_inode_scanner->record_index               = 0;
+	internal_inode_scanner->chunk_has_inodes           = 0;
+	internal_inode_scanner->inode_is_read              = 0;
+
+	return( 1 );
+}
+
+/* Takes over the current inode
+ * The inode scanner is provided with a new inode for reading the next inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_take_inode(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t *inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *new_inode = NULL;
+	static char *function       = "libfsxfs_internal_inode_scanner_take_inode";
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_internal_inode_scanner_free_extended_attributes(
+	     internal_inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extended attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_initialize(
+	     &new_inode,
+	     internal_inode_scanner->io_handle->inode_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_number = internal_inode_scanner->inode_number;
+	*inode        = internal_inode_scanner->inode;
+
+	internal_inode_scanner->inode         = new_inode;
+	internal_inode_scanner->inode_is_read = 0;
+
+	return( 1 );
+}
+
+/* Sets the current inode
+ * The inode scanner takes over management of the inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_set_inode(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_inode_scanner_set_inode";
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( inode == NULL )
+	 || ( *inode == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_internal_inode_scanner_free_extended_attributes(
+	     internal_inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extended attributes.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_inode_free(
+	     &( internal_inode_scanner->inode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free inode.",
+		 function );
+
+		goto on_error;
+	}
+	internal_inode_scanner->inode         = *inode;
+	internal_inode_scanner->inode_number  = inode_number;
+	internal_inode_scanner->inode_is_read = 1;
+
+	*inode = NULL;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_inode_scanner->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Reads an inode B+ tree block of the current allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_read_leaf_block(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t relative_block_number,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfsxfs_internal_inode_scanner_read_leaf_block";
+	off64_t btree_block_offset  = 0;
+	uint64_t btree_block_number = 0;
+	int compare_result          = 0;
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid inode scanner - invalid IO handle - block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_block_number > ( (uint64_t) ( INT64_MAX / internal_inode_scanner->io_handle->block_size ) - internal_inode_scanner->allocation_group_block_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->btree_block != NULL )
+	{
+		if( libfsxfs_btree_block_free(
+		     &( internal_inode_scanner->btree_block ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free B+ tree block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_inode_scanner->record_index = 0;
+
+	btree_block_number = internal_inode_scanner->allocation_group_block_number + relative_block_number;
+	btree_block_offset = (off64_t) btree_block_number * internal_inode_scanner->io_handle->block_size;
+
+	/* The B+ tree blocks are not stored in the B+ tree blocks cache of the file system
+	 * since a scan reads every leaf block only once
+	 */
+	if( libfsxfs_btree_block_initialize(
+	     &( internal_inode_scanner->btree_block ),
+	     internal_inode_scanner->io_handle->block_size,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create B+ tree block.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_btree_block_read_file_io_handle(
+	     internal_inode_scanner->btree_block,
+	     internal_inode_scanner->io_handle,
+	     internal_inode_scanner->file_io_handle,
+	     btree_block_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read inode B+ tree block: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 relative_block_number,
+		 btree_block_offset,
+		 btree_block_offset );
+
+		goto on_error;
+	}
+	if( internal_inode_scanner->io_handle->format_version == 5 )
+	{
+		compare_result = memory_compare(
+		                  internal_inode_scanner->btree_block->header->signature,
+		                  "IAB3",
+		                  4 );
+	}
+	else
+	{
+		compare_result = memory_compare(
+		                  internal_inode_scanner->btree_block->header->signature,
+		                  "IABT",
+		                  4 );
+	}
+	if( compare_result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block signature.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_inode_scanner->btree_block != NULL )
+	{
+		libfsxfs_btree_block_free(
+		 &( internal_inode_scanner->btree_block ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the first (left-most) inode B+ tree leaf block of a specific allocation group
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_read_first_leaf_block(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_information_t *inode_information = NULL;
+	static char *function                           = "libfsxfs_internal_inode_scanner_read_first_leaf_block";
+	size_t number_of_key_value_pairs                = 0;
+	uint32_t relative_block_number                  = 0;
+	int recursion_depth                             = 0;
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_file_system_get_inode_information(
+	     internal_inode_scanner->file_system,
+	     internal_inode_scanner->io_handle,
+	     internal_inode_scanner->file_io_handle,
+	     allocation_group_index,
+	     &inode_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	if( inode_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing inode information: %" PRIu32 ".",
+		 function,
+		 allocation_group_index );
+
+		return( -1 );
+	}
+	internal_inode_scanner->allocation_group_block_number = (uint64_t) allocation_group_index * internal_inode_scanner->io_handle->allocation_group_size;
+
+	relative_block_number = inode_information->inode_btree_root_block_number;
+
+	/* Descend the inode B+ tree by the first sub node of every branch node
+	 */
+	for( recursion_depth = 0;
+	     recursion_depth <= LIBFSXFS_MAXIMUM_RECURSION_DEPTH;
+	     recursion_depth++ )
+	{
+		if( libfsxfs_internal_inode_scanner_read_leaf_block(
+		     internal_inode_scanner,
+		     (uint64_t) relative_block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode B+ tree block: %" PRIu32 ".",
+			 function,
+			 relative_block_number );
+
+			return( -1 );
+		}
+		if( internal_inode_scanner->btree_block->header->level == 0 )
+		{
+			return( 1 );
+		}
+		if( internal_inode_scanner->btree_block->header->number_of_records == 0 )
+		{
+			break;
+		}
+		/* The sub block numbers are stored after the keys
+		 */
+		number_of_key_value_pairs = internal_inode_scanner->btree_block->records_data_size / 8;
+
+		byte_stream_copy_to_uint32_big_endian(
+		 &( internal_inode_scanner->btree_block->records_data[ number_of_key_value_pairs * 4 ] ),
+		 relative_block_number );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid inode B+ tree of allocation group: %" PRIu32 ".",
+	 function,
+	 allocation_group_index );
+
+	libfsxfs_btree_block_free(
+	 &( internal_inode_scanner->btree_block ),
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the inode chunk of the next record of the current inode B+ tree leaf block
+ * Only the range of the inode chunk that contains used inodes is read
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_read_chunk(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data     = NULL;
+	static char *function          = "libfsxfs_internal_inode_scanner_read_chunk";
+	size_t chunk_data_size         = 0;
+	size_t records_data_offset     = 0;
+	ssize_t read_count             = 0;
+	off64_t chunk_offset           = 0;
+	uint32_t relative_inode_number = 0;
+	uint8_t inode_index            = 0;
+	int result                     = 0;
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->btree_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing B+ tree block.",
+		 function );
+
+		return( -1 );
+	}
+	records_data_offset = (size_t) internal_inode_scanner->record_index * sizeof( fsxfs_inode_btree_record_t );
+
+	if( ( records_data_offset + sizeof( fsxfs_inode_btree_record_t ) ) > internal_inode_scanner->btree_block->records_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	record_data = &( internal_inode_scanner->btree_block->records_data[ records_data_offset ] );
+
+	internal_inode_scanner->record_index += 1;
+
+	byte_stream_copy_to_uint32_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) record_data )->inode_number,
+	 relative_inode_number );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_inode_btree_record_t *) record_data )->chunk_allocation_bitmap,
+	 internal_inode_scanner->chunk_allocation_bitmap );
+
+	internal_inode_scanner->chunk_has_inodes = 0;
+
+	/* A bit in the chunk allocation bitmap is set if the inode is unused
+	 */
+	if( internal_inode_scanner->chunk_allocation_bitmap == 0xffffffffffffffffUL )
+	{
+		return( 1 );
+	}
+	if( ( (uint64_t) relative_inode_number + 64 ) > ( (uint64_t) 1 << internal_inode_scanner->io_handle->number_of_relative_inode_number_bits ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid relative inode number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner->first_inode_index = 64;
+	internal_inode_scanner->last_inode_index  = 0;
+
+	for( inode_index = 0;
+	     inode_index < 64;
+	     inode_index++ )
+	{
+		if( ( internal_inode_scanner->chunk_allocation_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 )
+		{
+			continue;
+		}
+		if( inode_index < internal_inode_scanner->first_inode_index )
+		{
+			internal_inode_scanner->first_inode_index = inode_index;
+		}
+		internal_inode_scanner->last_inode_index = inode_index;
+	}
+	internal_inode_scanner->chunk_inode_number = ( (uint64_t) ( internal_inode_scanner->allocation_group_index - 1 ) << internal_inode_scanner->io_handle->number_of_relative_inode_number_bits )
+	                                           + relative_inode_number;
+
+	chunk_offset    = ( (off64_t) internal_inode_scanner->allocation_group_block_number * internal_inode_scanner->io_handle->block_size )
+	                + ( (off64_t) ( relative_inode_number + internal_inode_scanner->first_inode_index ) * internal_inode_scanner->io_handle->inode_size );
+	chunk_data_size = (size_t) ( internal_inode_scanner->last_inode_index - internal_inode_scanner->first_inode_index + 1 ) * internal_inode_scanner->io_handle->inode_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading inode chunk: %" PRIu64 " - %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 internal_inode_scanner->chunk_inode_number + internal_inode_scanner->first_inode_index,
+		 internal_inode_scanner->chunk_inode_number + internal_inode_scanner->last_inode_index,
+		 chunk_offset,
+		 chunk_offset );
+	}
+#endif
+	result = libfsxfs_io_handle_get_mapped_data(
+	          internal_inode_scanner->io_handle,
+	          chunk_offset,
+	          chunk_data_size,
+	          &( internal_inode_scanner->chunk_data ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 chunk_offset,
+		 chunk_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              internal_inode_scanner->file_io_handle,
+		              internal_inode_scanner->chunk_buffer,
+		              chunk_data_size,
+		              chunk_offset,
+		              error );
+
+		if( read_count != (ssize_t) chunk_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read inode chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			return( -1 );
+		}
+		internal_inode_scanner->chunk_data = internal_inode_scanner->chunk_buffer;
+	}
+	internal_inode_scanner->inode_index      = internal_inode_scanner->first_inode_index;
+	internal_inode_scanner->chunk_has_inodes = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next used inode
+ * The inodes are returned in on-disk order, per allocation group
+ * Returns 1 if successful, 0 if there are no more inodes or -1 on error
+ */
+int libfsxfs_inode_scanner_get_next_inode(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_next_inode";
+	size_t chunk_data_offset                                  = 0;
+	uint8_t inode_index                                       = 0;
+	int result                                                = 0;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_inode_scanner->inode_is_read = 0;
+
+	if( libfsxfs_internal_inode_scanner_free_extended_attributes(
+	     internal_inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free extended attributes.",
+		 function );
+
+		goto on_error;
+	}
+	while( result == 0 )
+	{
+		if( internal_inode_scanner->chunk_has_inodes != 0 )
+		{
+			inode_index = internal_inode_scanner->inode_index;
+
+			while( ( inode_index <= internal_inode_scanner->last_inode_index )
+			    && ( ( internal_inode_scanner->chunk_allocation_bitmap & ( (uint64_t) 1 << inode_index ) ) != 0 ) )
+			{
+				inode_index++;
+			}
+			if( inode_index > internal_inode_scanner->last_inode_index )
+			{
+				internal_inode_scanner->chunk_has_inodes = 0;
+
+				continue;
+			}
+			internal_inode_scanner->inode_index = inode_index + 1;
+
+			chunk_data_offset = (size_t) ( inode_index - internal_inode_scanner->first_inode_index ) * internal_inode_scanner->io_handle->inode_size;
+
+			if( memory_copy(
+			     internal_inode_scanner->inode->data,
+			     &( internal_inode_scanner->chunk_data[ chunk_data_offset ] ),
+			     internal_inode_scanner->inode->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy inode data.",
+				 function );
+
+				goto on_error;
+			}
+			internal_inode_scanner->inode_number = internal_inode_scanner->chunk_inode_number + inode_index;
+
+			if( libfsxfs_inode_read_data(
+			     internal_inode_scanner->inode,
+			     internal_inode_scanner->io_handle,
+			     internal_inode_scanner->inode->data,
+			     internal_inode_scanner->inode->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode: %" PRIu64 ".",
+				 function,
+				 internal_inode_scanner->inode_number );
+
+				goto on_error;
+			}
+			internal_inode_scanner->inode_is_read = 1;
+
+			result = 1;
+		}
+		else if( ( internal_inode_scanner->btree_block != NULL )
+		      && ( internal_inode_scanner->record_index < internal_inode_scanner->btree_block->header->number_of_records ) )
+		{
+			if( libfsxfs_internal_inode_scanner_read_chunk(
+			     internal_inode_scanner,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode chunk.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The leaf blocks of the inode B+ tree are chained by their next block number,
+		 * where 0xffffffff represents the end of the chain
+		 */
+		else if( ( internal_inode_scanner->btree_block != NULL )
+		      && ( internal_inode_scanner->btree_block->header->next_btree_block_number != 0xffffffffUL ) )
+		{
+			if( libfsxfs_internal_inode_scanner_read_leaf_block(
+			     internal_inode_scanner,
+			     internal_inode_scanner->btree_block->header->next_btree_block_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read next inode B+ tree leaf block.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_inode_scanner->btree_block->header->level != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported next inode B+ tree leaf block level.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( internal_inode_scanner->allocation_group_index < internal_inode_scanner->end_allocation_group_index )
+		{
+			if( libfsxfs_internal_inode_scanner_read_first_leaf_block(
+			     internal_inode_scanner,
+			     internal_inode_scanner->allocation_group_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read first inode B+ tree leaf block of allocation group: %" PRIu32 ".",
+				 function,
+				 internal_inode_scanner->allocation_group_index );
+
+				goto on_error;
+			}
+			internal_inode_scanner->allocation_group_index += 1;
+		}
+		else
+		{
+			break;
+		}
+	}
+	if( result == 1 )
+	{
+		*inode_number = internal_inode_scanner->inode_number;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_inode_scanner->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the file mode of the current inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_file_mode(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint16_t *file_mode,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_file_mode";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_file_mode(
+		          internal_inode_scanner->inode,
+		          file_mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file mode.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the current inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_size(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_size";
+	uint64_t data_size                                        = 0;
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_data_size(
+		          internal_inode_scanner->inode,
+		          &data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data size.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*size = (size64_t) data_size;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of links of the current inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_number_of_links(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint32_t *number_of_links,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_number_of_links";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_number_of_links(
+		          internal_inode_scanner->inode,
+		          number_of_links,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of links.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the access date and time of the current inode
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_access_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_access_time";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_access_time(
+		          internal_inode_scanner->inode,
+		          posix_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access time.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the creation date and time of the current inode
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nanoseconds
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_inode_scanner_get_creation_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_creation_time";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_creation_time(
+		          internal_inode_scanner->inode,
+		          posix_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve creation time.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the inode change date and time of the current inode
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_inode_change_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_inode_change_time";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_inode_change_time(
+		          internal_inode_scanner->inode,
+		          posix_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode change time.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the modification date and time of the current inode
+ * The timestamp is a signed 64-bit POSIX date and time value in number of nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_modification_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_modification_time";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		result = libfsxfs_inode_get_modification_time(
+		          internal_inode_scanner->inode,
+		          posix_time,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve modification time.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Frees the extended attributes of the current inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_free_extended_attributes(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_inode_scanner_free_extended_attributes";
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->extended_attributes_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_inode_scanner->extended_attributes_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_attribute_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free extended attributes array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the extended attributes of the current inode
+ * Shortform extended attributes are read from the inode data copied from the inode chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_internal_inode_scanner_get_extended_attributes(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_internal_inode_scanner_get_extended_attributes";
+
+	if( internal_inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->inode_is_read == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid inode scanner - missing current inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_inode_scanner->extended_attributes_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode scanner - extended attributes array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_inode_scanner->extended_attributes_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create extended attributes array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_attributes_read_from_inode(
+	     internal_inode_scanner->io_handle,
+	     internal_inode_scanner->file_io_handle,
+	     internal_inode_scanner->inode,
+	     internal_inode_scanner->extended_attributes_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extended attributes of inode: %" PRIu64 ".",
+		 function,
+		 internal_inode_scanner->inode_number );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_inode_scanner->extended_attributes_array != NULL )
+	{
+		libcdata_array_free(
+		 &( internal_inode_scanner->extended_attributes_array ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsxfs_attribute_values_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of extended attributes of the current inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_number_of_extended_attributes(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int *number_of_extended_attributes,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_number_of_extended_attributes";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->extended_attributes_array == NULL )
+	{
+		if( libfsxfs_internal_inode_scanner_get_extended_attributes(
+		     internal_inode_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extended attributes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_inode_scanner->extended_attributes_array != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_inode_scanner->extended_attributes_array,
+		     number_of_extended_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries from extended attributes array.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the extended attribute of the current inode for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_inode_scanner_get_extended_attribute_by_index(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int extended_attribute_index,
+     libfsxfs_extended_attribute_t **extended_attribute,
+     libcerror_error_t **error )
+{
+	libfsxfs_attribute_values_t *attribute_values             = NULL;
+	libfsxfs_attribute_values_t *safe_attribute_values        = NULL;
+	libfsxfs_inode_t *safe_inode                              = NULL;
+	libfsxfs_internal_inode_scanner_t *internal_inode_scanner = NULL;
+	static char *function                                     = "libfsxfs_inode_scanner_get_extended_attribute_by_index";
+	int result                                                = 1;
+
+	if( inode_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_inode_scanner = (libfsxfs_internal_inode_scanner_t *) inode_scanner;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( *extended_attribute != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid extended attribute value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_inode_scanner->extended_attributes_array == NULL )
+	{
+		if( libfsxfs_internal_inode_scanner_get_extended_attributes(
+		     internal_inode_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine extended attributes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The extended attribute is given its own copy of the inode and attribute values
+	 * since the inode scanner replaces them when it moves to another inode
+	 */
+	if( internal_inode_scanner->extended_attributes_array != NULL )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_inode_scanner->extended_attributes_array,
+		     extended_attribute_index,
+		     (intptr_t **) &attribute_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d values.",
+			 function,
+			 extended_attribute_index );
+
+			result = -1;
+		}
+		else if( libfsxfs_inode_clone_attributes(
+		          &safe_inode,
+		          internal_inode_scanner->inode,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create attributes inode.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfsxfs_attribute_values_clone(
+		          &safe_attribute_values,
+		          attribute_values,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create attribute: %d values.",
+			 function,
+			 extended_attribute_index );
+
+			result = -1;
+		}
+		else if( libfsxfs_extended_attribute_initialize(
+		          extended_attribute,
+		          internal_inode_scanner->io_handle,
+		          internal_inode_scanner->file_io_handle,
+		          internal_inode_scanner->file_system,
+		          safe_inode,
+		          safe_attribute_values,
+		          LIBFSXFS_EXTENDED_ATTRIBUTE_FLAG_MANAGED_VALUES,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create extended attribute.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == -1 )
+	{
+		if( safe_attribute_values != NULL )
+		{
+			libfsxfs_attribute_values_free(
+			 &safe_attribute_values,
+			 NULL );
+		}
+		if( safe_inode != NULL )
+		{
+			libfsxfs_inode_free(
+			 &safe_inode,
+			 NULL );
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_inode_scanner->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,256 @@
+/*
+ * Inode scanner functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSXFS_INODE_SCANNER_H )
+#define _LIBFSXFS_INODE_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_btree_block.h"
+#include "libfsxfs_extern.h"
+#include "libfsxfs_file_system.h"
+#include "libfsxfs_inode.h"
+#include "libfsxfs_io_handle.h"
+#include "libfsxfs_libbfio.h"
+#include "libfsxfs_libcdata.h"
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_libcthreads.h"
+#include "libfsxfs_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsxfs_internal_inode_scanner libfsxfs_internal_inode_scanner_t;
+
+struct libfsxfs_internal_inode_scanner
+{
+	/* The IO handle
+	 */
+	libfsxfs_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file system
+	 */
+	libfsxfs_file_system_t *file_system;
+
+	/* The number of allocation groups
+	 */
+	uint32_t number_of_allocation_groups;
+
+	/* The index of the next allocation group to scan
+	 */
+	uint32_t allocation_group_index;
+
+	/* The index of the allocation group after the last allocation group to scan
+	 */
+	uint32_t end_allocation_group_index;
+
+	/* The block number of the start of the current allocation group
+	 */
+	uint64_t allocation_group_block_number;
+
+	/* The current inode B+ tree leaf block
+	 */
+	libfsxfs_btree_block_t *btree_block;
+
+	/* The index of the next record in the current inode B+ tree leaf block
+	 */
+	uint16_t record_index;
+
+	/* The inode chunk data, which either refers to the chunk buffer or the memory mapped volume data
+	 */
+	const uint8_t *chunk_data;
+
+	/* The inode chunk buffer
+	 */
+	uint8_t *chunk_buffer;
+
+	/* The inode number of the first inode in the current inode chunk
+	 */
+	uint64_t chunk_inode_number;
+
+	/* The chunk allocation bitmap of the current inode chunk
+	 */
+	uint64_t chunk_allocation_bitmap;
+
+	/* The index of the first inode in the chunk data
+	 */
+	uint8_t first_inode_index;
+
+	/* The index of the last inode in the chunk data
+	 */
+	uint8_t last_inode_index;
+
+	/* The index of the next inode in the current inode chunk
+	 */
+	uint8_t inode_index;
+
+	/* Value to indicate the current inode chunk contains more inodes
+	 */
+	uint8_t chunk_has_inodes;
+
+	/* The current inode
+	 */
+	libfsxfs_inode_t *inode;
+
+	/* The current inode number
+	 */
+	uint64_t inode_number;
+
+	/* Value to indicate the current inode was read
+	 */
+	uint8_t inode_is_read;
+
+	/* The extended attributes array of the current inode
+	 */
+	libcdata_array_t *extended_attributes_array;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsxfs_inode_scanner_initialize(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint32_t number_of_allocation_groups,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_close(
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_set_allocation_group(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_take_inode(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t *inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_set_inode(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t inode_number,
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_read_leaf_block(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint64_t relative_block_number,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_read_first_leaf_block(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     uint32_t allocation_group_index,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_read_chunk(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_next_inode(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_file_mode(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint16_t *file_mode,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_size(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_number_of_links(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint32_t *number_of_links,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_access_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_creation_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_inode_change_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_modification_time(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int64_t *posix_time,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_free_extended_attributes(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error );
+
+int libfsxfs_internal_inode_scanner_get_extended_attributes(
+     libfsxfs_internal_inode_scanner_t *internal_inode_scanner,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_number_of_extended_attributes(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int *number_of_extended_attributes,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_inode_scanner_get_extended_attribute_by_index(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     int extended_attribute_index,
+     libfsxfs_extended_attribute_t **extended_attribute,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSXFS_INODE_SCANNER_H ) */
+
@@ -172,3 +172,60 @@ int libfsxfs_io_handle_clear(
 	return( 1 );
 }
 
+
+/* Retrieves the memory mapped data of a specific range of the volume
+ * Returns 1 if successful, 0 if the range is not memory mapped or -1 on error
+ */
+int libfsxfs_io_handle_get_mapped_data(
+     libfsxfs_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_io_handle_get_mapped_data";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->mapped_data == NULL )
+	 || ( (size64_t) offset >= io_handle->mapped_data_size )
+	 || ( (size64_t) size > ( io_handle->mapped_data_size - offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( io_handle->mapped_data[ offset ] );
+
+	return( 1 );
+}
+
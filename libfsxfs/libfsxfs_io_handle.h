@@ -84,6 +84,18 @@ struct libfsxfs_io_handle
 	 */
 	uint8_t number_of_relative_inode_number_bits;
 
+	/* Value to indicate if metadata checksums should be verified
+	 */
+	uint8_t verify_checksums;
+
+	/* The memory mapped volume data
+	 */
+	const uint8_t *mapped_data;
+
+	/* The memory mapped volume data size
+	 */
+	size64_t mapped_data_size;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -101,6 +113,13 @@ int libfsxfs_io_handle_clear(
      libfsxfs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfsxfs_io_handle_get_mapped_data(
+     libfsxfs_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,117 @@
+/*
+ * Name hash functions
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsxfs_libcerror.h"
+#include "libfsxfs_name_hash.h"
+
+/* Rotates a 32-bit value left
+ */
+#define libfsxfs_name_hash_rotate_left32( value, number_of_bits ) \
+	( ( (uint32_t) ( value ) << ( number_of_bits ) ) | ( (uint32_t) ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+/* Calculates the hash of a directory entry or extended attribute name
+ * The name is hashed as a byte stream, 4 bytes at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_name_hash_calculate(
+     uint32_t *name_hash,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsxfs_name_hash_calculate";
+	size_t name_index     = 0;
+	uint32_t safe_hash    = 0;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( name_size - name_index ) >= 4 )
+	{
+		safe_hash = ( (uint32_t) name[ name_index ] << 21 )
+		          ^ ( (uint32_t) name[ name_index + 1 ] << 14 )
+		          ^ ( (uint32_t) name[ name_index + 2 ] << 7 )
+		          ^ (uint32_t) name[ name_index + 3 ]
+		          ^ libfsxfs_name_hash_rotate_left32( safe_hash, 7 * 4 );
+
+		name_index += 4;
+	}
+	switch( name_size - name_index )
+	{
+		case 3:
+			safe_hash = ( (uint32_t) name[ name_index ] << 14 )
+			          ^ ( (uint32_t) name[ name_index + 1 ] << 7 )
+			          ^ (uint32_t) name[ name_index + 2 ]
+			          ^ libfsxfs_name_hash_rotate_left32( safe_hash, 7 * 3 );
+			break;
+
+		case 2:
+			safe_hash = ( (uint32_t) name[ name_index ] << 7 )
+			          ^ (uint32_t) name[ name_index + 1 ]
+			          ^ libfsxfs_name_hash_rotate_left32( safe_hash, 7 * 2 );
+			break;
+
+		case 1:
+			safe_hash = (uint32_t) name[ name_index ]
+			          ^ libfsxfs_name_hash_rotate_left32( safe_hash, 7 );
+			break;
+
+		default:
+			break;
+	}
+	*name_hash = safe_hash;
+
+	return( 1 );
+}
+
@@ -263,6 +263,14 @@ int libfsxfs_superblock_read_data(
 	 ( (fsxfs_superblock_t *) data )->number_of_inodes_per_block,
 	 number_of_inodes_per_block );
 
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->number_of_inodes,
+	 superblock->number_of_inodes );
+
+	byte_stream_copy_to_uint64_big_endian(
+	 ( (fsxfs_superblock_t *) data )->number_of_free_inodes,
+	 superblock->number_of_free_inodes );
+
 	if( memory_copy(
 	     superblock->volume_label,
 	     ( (fsxfs_superblock_t *) data )->volume_label,
@@ -509,21 +517,15 @@ int libfsxfs_superblock_read_data(
 		 function,
 		 ( (fsxfs_superblock_t *) data )->inodes_percentage );
 
-		byte_stream_copy_to_uint64_big_endian(
-		 ( (fsxfs_superblock_t *) data )->number_of_inodes,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: number of inodes\t\t\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 superblock->number_of_inodes );
 
-		byte_stream_copy_to_uint64_big_endian(
-		 ( (fsxfs_superblock_t *) data )->number_of_free_inodes,
-		 value_64bit );
 		libcnotify_printf(
 		 "%s: number of free inodes\t\t\t: %" PRIu64 "\n",
 		 function,
-		 value_64bit );
+		 superblock->number_of_free_inodes );
 
 		byte_stream_copy_to_uint64_big_endian(
 		 ( (fsxfs_superblock_t *) data )->number_of_free_data_blocks,
@@ -78,6 +78,14 @@ struct libfsxfs_superblock
 	 */
 	uint16_t inode_size;
 
+	/* Number of (allocated) inodes
+	 */
+	uint64_t number_of_inodes;
+
+	/* Number of free inodes
+	 */
+	uint64_t number_of_free_inodes;
+
 	/* Directory block size
 	 */
 	uint32_t directory_block_size;
@@ -31,12 +31,15 @@
 #include "libfsxfs_file_entry.h"
 #include "libfsxfs_file_system.h"
 #include "libfsxfs_inode.h"
+#include "libfsxfs_inode_scan_pool.h"
+#include "libfsxfs_inode_scanner.h"
 #include "libfsxfs_io_handle.h"
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcnotify.h"
 #include "libfsxfs_libcthreads.h"
 #include "libfsxfs_libuna.h"
+#include "libfsxfs_memory_map.h"
 #include "libfsxfs_superblock.h"
 #include "libfsxfs_volume.h"
 
@@ -268,18 +271,18 @@ int libfsxfs_volume_signal_abort(
 	return( 1 );
 }
 
-/* Opens a volume
+/* Sets the value to indicate if the allocation groups should be read on open
+ * By default the inode information of an allocation group is read on the
+ * first inode lookup in that allocation group
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open(
+int libfsxfs_volume_set_read_allocation_groups_on_open(
      libfsxfs_volume_t *volume,
-     const char *filename,
-     int access_flags,
+     uint8_t read_on_open,
      libcerror_error_t **error )
 {
-	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_open";
+	static char *function                       = "libfsxfs_volume_set_read_allocation_groups_on_open";
 
 	if( volume == NULL )
 	{
@@ -294,100 +297,154 @@ int libfsxfs_volume_open(
 	}
 	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-	if( filename == NULL )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
-	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+#endif
+	if( read_on_open != 0 )
+	{
+		internal_volume->read_allocation_groups_on_open = 1;
+	}
+	else
+	{
+		internal_volume->read_allocation_groups_on_open = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported access flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+#endif
+	return( 1 );
+}
+
+/* Sets the value to indicate if the metadata checksums should be verified
+ * This only applies to format version 5 volumes and takes effect on the next open
+ * By default the metadata checksums are not verified
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_verify_metadata_checksums(
+     libfsxfs_volume_t *volume,
+     uint8_t verify_checksums,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_verify_metadata_checksums";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: write access currently not supported.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
+#endif
+	if( verify_checksums != 0 )
+	{
+		internal_volume->verify_metadata_checksums = 1;
+	}
+	else
+	{
+		internal_volume->verify_metadata_checksums = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set track offsets read in file IO handle.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     narrow_string_length(
-	      filename ) + 1,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Sets the maximum number of file IO handles
+ * The file IO handles are clones of the file IO handle used to open the volume
+ * and allow metadata and data to be read from multiple threads concurrently
+ * A value of 0 disables the use of cloned file IO handles
+ * This takes effect on the next open
+ * By default no cloned file IO handles are used
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_maximum_number_of_file_io_handles(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_maximum_number_of_file_io_handles";
+
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set filename in file IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfsxfs_volume_open_file_io_handle(
-	     volume,
-	     file_io_handle,
-	     access_flags,
-	     error ) != 1 )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( ( maximum_number_of_file_io_handles < 0 )
+	 || ( maximum_number_of_file_io_handles > LIBFSXFS_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %s.",
-		 function,
-		 filename );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of file IO handles value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -401,10 +458,10 @@ int libfsxfs_volume_open(
 		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #endif
-	internal_volume->file_io_handle_created_in_library = 1;
+	internal_volume->maximum_number_of_file_io_handles = maximum_number_of_file_io_handles;
 
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -418,37 +475,94 @@ int libfsxfs_volume_open(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_volume->file_io_handle_created_in_library = 0;
-
-		goto on_error;
+		return( -1 );
 	}
 #endif
 	return( 1 );
+}
 
-on_error:
-	if( file_io_handle != NULL )
+/* Sets the value to indicate if the volume should be memory mapped
+ * Memory mapping only applies to volumes opened with libfsxfs_volume_open
+ * that are regular files, otherwise the file IO handle is used
+ * This takes effect on the next open
+ * By default the volume is not memory mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_set_use_memory_mapping(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_set_use_memory_mapping";
+
+	if( volume == NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
-}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( use_memory_mapping != 0 )
+	{
+		internal_volume->use_memory_mapping = 1;
+	}
+	else
+	{
+		internal_volume->use_memory_mapping = 0;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
 
 /* Opens a volume
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open_wide(
+int libfsxfs_volume_open(
      libfsxfs_volume_t *volume,
-     const wchar_t *filename,
+     const char *filename,
      int access_flags,
      libcerror_error_t **error )
 {
 	libbfio_handle_t *file_io_handle            = NULL;
 	libfsxfs_internal_volume_t *internal_volume = NULL;
-	static char *function                       = "libfsxfs_volume_open_wide";
+	static char *function                       = "libfsxfs_volume_open";
+	int result                                  = 0;
 
 	if( volume == NULL )
 	{
@@ -497,6 +611,17 @@ int libfsxfs_volume_open_wide(
 
 		return( -1 );
 	}
+	if( internal_volume->memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume - memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -526,10 +651,10 @@ int libfsxfs_volume_open_wide(
 		goto on_error;
 	}
 #endif
-	if( libbfio_file_set_name_wide(
+	if( libbfio_file_set_name(
 	     file_io_handle,
 	     filename,
-	     wide_string_length(
+	     narrow_string_length(
 	      filename ) + 1,
 	     error ) != 1 )
 	{
@@ -542,6 +667,57 @@ int libfsxfs_volume_open_wide(
 
 		goto on_error;
 	}
+	if( internal_volume->use_memory_mapping != 0 )
+	{
+		if( libfsxfs_memory_map_initialize(
+		     &( internal_volume->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create memory map.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfsxfs_memory_map_open(
+		          internal_volume->memory_map,
+		          filename,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map volume: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			/* Memory mapping is not supported, the volume is read using the file IO handle
+			 */
+			if( libfsxfs_memory_map_free(
+			     &( internal_volume->memory_map ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free memory map.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
 	if( libfsxfs_volume_open_file_io_handle(
 	     volume,
 	     file_io_handle,
@@ -552,7 +728,7 @@ int libfsxfs_volume_open_wide(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open volume: %ls.",
+		 "%s: unable to open volume: %s.",
 		 function,
 		 filename );
 
@@ -595,6 +771,12 @@ int libfsxfs_volume_open_wide(
 	return( 1 );
 
 on_error:
+	if( internal_volume->memory_map != NULL )
+	{
+		libfsxfs_memory_map_free(
+		 &( internal_volume->memory_map ),
+		 NULL );
+	}
 	if( file_io_handle != NULL )
 	{
 		libbfio_handle_free(
@@ -604,14 +786,183 @@ on_error:
 	return( -1 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
 
-/* Opens a volume using a Basic File IO (bfio) handle
+/* Opens a volume
  * Returns 1 if successful or -1 on error
  */
-int libfsxfs_volume_open_file_io_handle(
+int libfsxfs_volume_open_wide(
      libfsxfs_volume_t *volume,
-     libbfio_handle_t *file_io_handle,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle            = NULL;
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_open_wide";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBFSXFS_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBFSXFS_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libbfio_handle_set_track_offsets_read(
+	     file_io_handle,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set track offsets read in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     wide_string_length(
+	      filename ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_open_file_io_handle(
+	     volume,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_volume->file_io_handle_created_in_library = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_volume->file_io_handle_created_in_library = 0;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a volume using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_open_file_io_handle(
+     libfsxfs_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
      int access_flags,
      libcerror_error_t **error )
 {
@@ -930,6 +1281,25 @@ int libfsxfs_volume_close(
 			result = -1;
 		}
 	}
+	/* The memory map is freed after the file system since the cached
+	 * metadata can refer to the memory mapped volume data
+	 */
+	if( internal_volume->memory_map != NULL )
+	{
+		if( libfsxfs_memory_map_free(
+		     &( internal_volume->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -957,11 +1327,12 @@ int libfsxfs_internal_volume_open_read(
      libcerror_error_t **error )
 {
 	libfsxfs_superblock_t *superblock = NULL;
+	const uint8_t *mapped_data        = NULL;
 	static char *function             = "libfsxfs_internal_volume_open_read";
 	off64_t allocation_group_size     = 0;
-	off64_t inode_information_offset  = 0;
 	off64_t superblock_offset         = 0;
 	uint32_t allocation_group_index   = 0;
+	int result                        = 0;
 
 	if( internal_volume == NULL )
 	{
@@ -1021,6 +1392,11 @@ int libfsxfs_internal_volume_open_read(
 
 		goto on_error;
 	}
+	if( internal_volume->memory_map != NULL )
+	{
+		internal_volume->io_handle->mapped_data      = internal_volume->memory_map->data;
+		internal_volume->io_handle->mapped_data_size = internal_volume->memory_map->data_size;
+	}
 	do
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1047,11 +1423,43 @@ int libfsxfs_internal_volume_open_read(
 
 			goto on_error;
 		}
-		if( libfsxfs_superblock_read_file_io_handle(
-		     superblock,
-		     file_io_handle,
-		     superblock_offset,
-		     error ) != 1 )
+		result = libfsxfs_io_handle_get_mapped_data(
+		          internal_volume->io_handle,
+		          superblock_offset,
+		          512,
+		          &mapped_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory mapped data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 superblock_offset,
+			 superblock_offset );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			result = libfsxfs_superblock_read_data(
+			          superblock,
+			          mapped_data,
+			          512,
+			          error );
+		}
+		else
+		{
+			result = libfsxfs_superblock_read_file_io_handle(
+			          superblock,
+			          file_io_handle,
+			          superblock_offset,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1079,21 +1487,10 @@ int libfsxfs_internal_volume_open_read(
 			internal_volume->io_handle->directory_block_size                 = superblock->directory_block_size;
 			internal_volume->io_handle->number_of_relative_block_number_bits = superblock->number_of_relative_block_number_bits;
 			internal_volume->io_handle->number_of_relative_inode_number_bits = superblock->number_of_relative_inode_number_bits;
+			internal_volume->io_handle->verify_checksums                     = internal_volume->verify_metadata_checksums;
 
 			superblock = NULL;
 		}
-		inode_information_offset = superblock_offset + 2 * internal_volume->superblock->sector_size;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading inode information: %" PRIu32 " at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 allocation_group_index,
-			 inode_information_offset,
-			 inode_information_offset );
-		}
-#endif
 		if( internal_volume->file_system == NULL )
 		{
 			if( libfsxfs_file_system_initialize(
@@ -1110,22 +1507,61 @@ int libfsxfs_internal_volume_open_read(
 
 				goto on_error;
 			}
+			if( libfsxfs_file_system_set_number_of_allocation_groups(
+			     internal_volume->file_system,
+			     internal_volume->superblock->number_of_allocation_groups,
+			     2 * (off64_t) internal_volume->superblock->sector_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set number of allocation groups in file system.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_volume->maximum_number_of_file_io_handles > 0 )
+			{
+				if( libfsxfs_file_system_initialize_file_io_handle_pool(
+				     internal_volume->file_system,
+				     file_io_handle,
+				     internal_volume->maximum_number_of_file_io_handles,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create file IO handle pool in file system.",
+					 function );
+
+					goto on_error;
+				}
+			}
 		}
-		if( libfsxfs_file_system_read_inode_information(
-		     internal_volume->file_system,
-		     internal_volume->io_handle,
-		     file_io_handle,
-		     inode_information_offset,
-		     error ) != 1 )
+		/* By default the inode information of an allocation group is read
+		 * on the first inode lookup in that allocation group
+		 */
+		if( internal_volume->read_allocation_groups_on_open != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read inode B+ tree.",
-			 function );
+			if( libfsxfs_file_system_read_inode_information(
+			     internal_volume->file_system,
+			     internal_volume->io_handle,
+			     file_io_handle,
+			     allocation_group_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read inode B+ tree.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		if( superblock != NULL )
 		{
@@ -1161,9 +1597,11 @@ int libfsxfs_internal_volume_open_read(
 
 		allocation_group_index++;
 	}
-	while( allocation_group_index < internal_volume->superblock->number_of_allocation_groups );
+	while( ( internal_volume->read_allocation_groups_on_open != 0 )
+	    && ( allocation_group_index < internal_volume->superblock->number_of_allocation_groups ) );
 
-	if( allocation_group_index != internal_volume->superblock->number_of_allocation_groups )
+	if( ( internal_volume->read_allocation_groups_on_open != 0 )
+	 && ( allocation_group_index != internal_volume->superblock->number_of_allocation_groups ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1177,6 +1615,9 @@ int libfsxfs_internal_volume_open_read(
 	return( 1 );
 
 on_error:
+	internal_volume->io_handle->mapped_data      = NULL;
+	internal_volume->io_handle->mapped_data_size = 0;
+
 	if( internal_volume->file_system != NULL )
 	{
 		libfsxfs_file_system_free(
@@ -1361,7 +1802,7 @@ int libfsxfs_volume_get_features_flags(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
@@ -1381,7 +1822,7 @@ int libfsxfs_volume_get_features_flags(
 	*incompatible_features_flags         = internal_volume->superblock->incompatible_features_flags;
 	*journal_incompatible_features_flags = internal_volume->superblock->journal_incompatible_features_flags;
 
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
@@ -1739,18 +2180,20 @@ int libfsxfs_volume_get_utf16_label(
 	return( result );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the number of file entries (used inodes)
+ * Returns 1 if successful or -1 on error
  */
-int libfsxfs_internal_volume_get_root_directory(
-     libfsxfs_internal_volume_t *internal_volume,
-     libfsxfs_file_entry_t **file_entry,
+int libfsxfs_volume_get_number_of_file_entries(
+     libfsxfs_volume_t *volume,
+     uint32_t *number_of_file_entries,
      libcerror_error_t **error )
 {
-	libfsxfs_inode_t *inode = NULL;
-	static char *function   = "libfsxfs_volume_get_root_directory";
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_number_of_file_entries";
+	uint64_t number_of_used_inodes              = 0;
+	int result                                  = 1;
 
-	if( internal_volume == NULL )
+	if( volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1761,7 +2204,119 @@ int libfsxfs_internal_volume_get_root_directory(
 
 		return( -1 );
 	}
-	if( internal_volume->superblock == NULL )
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_file_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of file entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The superblock contains the number of allocated and free inodes
+	 */
+	if( internal_volume->superblock->number_of_free_inodes > internal_volume->superblock->number_of_inodes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid superblock - number of free inodes value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		number_of_used_inodes = internal_volume->superblock->number_of_inodes - internal_volume->superblock->number_of_free_inodes;
+
+		if( number_of_used_inodes > (uint64_t) UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of used inodes value exceeds maximum.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*number_of_file_entries = (uint32_t) number_of_used_inodes;
+		}
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsxfs_internal_volume_get_root_directory(
+     libfsxfs_internal_volume_t *internal_volume,
+     libfsxfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_t *inode = NULL;
+	static char *function   = "libfsxfs_volume_get_root_directory";
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->superblock == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1873,7 +2428,7 @@ int libfsxfs_volume_get_root_directory(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1881,7 +2436,7 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1904,7 +2459,7 @@ int libfsxfs_volume_get_root_directory(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1912,7 +2467,7 @@ int libfsxfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsxfs_file_entry_free(
@@ -2069,8 +2624,8 @@ int libfsxfs_volume_get_file_entry_by_inode(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2078,7 +2633,7 @@ int libfsxfs_volume_get_file_entry_by_inode(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2100,8 +2655,8 @@ int libfsxfs_volume_get_file_entry_by_inode(
 
 		result = -1;
 	}
-#if defined( HAVE_LIBFSEXT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2109,7 +2664,7 @@ int libfsxfs_volume_get_file_entry_by_inode(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsxfs_file_entry_free(
@@ -2263,7 +2818,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2271,7 +2826,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2296,7 +2851,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2304,7 +2859,7 @@ int libfsxfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsxfs_file_entry_free(
@@ -2458,7 +3013,7 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2466,7 +3021,7 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2491,7 +3046,7 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2499,7 +3054,7 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsxfs_file_entry_free(
@@ -2512,3 +3067,528 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
 	return( result );
 }
 
+/* Opens an inode scanner that retrieves the used inodes in on-disk order
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_open_inode_scanner(
+     libfsxfs_volume_t *volume,
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_open_inode_scanner";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_inode_scanner_initialize(
+	     inode_scanner,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libfsxfs_inode_scanner_close(
+		 inode_scanner,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Scans the used inodes using multiple threads
+ * Every thread scans a different allocation group using its own file IO handle
+ * The callback function is called from the calling thread for every used inode
+ * with an inode scanner that provides access to the attributes of the inode
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_scan_inodes(
+     libfsxfs_volume_t *volume,
+     int number_of_threads,
+     uint8_t scan_flags,
+     int (*callback_function)(
+            libfsxfs_inode_scanner_t *inode_scanner,
+            uint64_t inode_number,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_scan_inodes";
+	int result                                  = 1;
+
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	libfsxfs_inode_scan_pool_t *scan_pool       = NULL;
+#else
+	libfsxfs_inode_scanner_t *inode_scanner     = NULL;
+	uint64_t inode_number                       = 0;
+	int callback_result                         = 0;
+#endif
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsxfs_inode_scan_pool_initialize(
+	     &scan_pool,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     number_of_threads,
+	     scan_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scan pool.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+	/* The volume lock is not held while scanning so that the callback function
+	 * can use the volume
+	 */
+	if( result == 1 )
+	{
+		if( libfsxfs_inode_scan_pool_run(
+		     scan_pool,
+		     callback_function,
+		     callback_arguments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan inodes.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( scan_pool != NULL )
+	{
+		if( libfsxfs_inode_scan_pool_free(
+		     &scan_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode scan pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+#else
+	/* Without multi-thread support the inodes are scanned by the calling thread
+	 * which delivers them in inode number order
+	 */
+	if( libfsxfs_inode_scanner_initialize(
+	     &inode_scanner,
+	     internal_volume->io_handle,
+	     internal_volume->file_io_handle,
+	     internal_volume->file_system,
+	     internal_volume->superblock->number_of_allocation_groups,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode scanner.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		callback_result = libfsxfs_inode_scanner_get_next_inode(
+		                   inode_scanner,
+		                   &inode_number,
+		                   error );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next inode.",
+			 function );
+
+			result = -1;
+		}
+		else if( callback_result == 1 )
+		{
+			callback_result = callback_function(
+			                   inode_scanner,
+			                   inode_number,
+			                   callback_arguments );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: callback function failed for inode: %" PRIu64 ".",
+				 function,
+				 inode_number );
+
+				result = -1;
+			}
+		}
+	}
+	while( callback_result == 1 );
+
+	if( libfsxfs_inode_scanner_close(
+	     &inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close inode scanner.",
+		 function );
+
+		result = -1;
+	}
+#endif /* defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
+/* Retrieves the inodes cache statistics
+ * The number of evictions is exact, it is the number of cached inodes that
+ * were replaced to make room for another inode
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_inodes_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_inodes_cache_statistics";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_get_inodes_cache_statistics(
+	     internal_volume->file_system,
+	     number_of_hits,
+	     number_of_misses,
+	     number_of_evictions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inodes cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the directory entries cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsxfs_volume_get_directory_entries_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libfsxfs_internal_volume_t *internal_volume = NULL;
+	static char *function                       = "libfsxfs_volume_get_directory_entries_cache_statistics";
+	int result                                  = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsxfs_internal_volume_t *) volume;
+
+	if( internal_volume->file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid internal volume - missing file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsxfs_file_system_get_directory_entries_cache_statistics(
+	     internal_volume->file_system,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory entries cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
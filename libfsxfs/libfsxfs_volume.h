@@ -33,6 +33,7 @@
 #include "libfsxfs_libcdata.h"
 #include "libfsxfs_libcerror.h"
 #include "libfsxfs_libcthreads.h"
+#include "libfsxfs_memory_map.h"
 #include "libfsxfs_superblock.h"
 #include "libfsxfs_types.h"
 
@@ -72,6 +73,26 @@ struct libfsxfs_internal_volume
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* Value to indicate if the allocation groups should be read on open
+	 */
+	uint8_t read_allocation_groups_on_open;
+
+	/* Value to indicate if the metadata checksums should be verified
+	 */
+	uint8_t verify_metadata_checksums;
+
+	/* The maximum number of file IO handles
+	 */
+	int maximum_number_of_file_io_handles;
+
+	/* Value to indicate if the volume should be memory mapped
+	 */
+	uint8_t use_memory_mapping;
+
+	/* The memory map
+	 */
+	libfsxfs_memory_map_t *memory_map;
+
 #if defined( HAVE_LIBFSXFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -94,6 +115,30 @@ int libfsxfs_volume_signal_abort(
      libfsxfs_volume_t *volume,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_read_allocation_groups_on_open(
+     libfsxfs_volume_t *volume,
+     uint8_t read_on_open,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_verify_metadata_checksums(
+     libfsxfs_volume_t *volume,
+     uint8_t verify_checksums,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_maximum_number_of_file_io_handles(
+     libfsxfs_volume_t *volume,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_set_use_memory_mapping(
+     libfsxfs_volume_t *volume,
+     uint8_t use_memory_mapping,
+     libcerror_error_t **error );
+
 LIBFSXFS_EXTERN \
 int libfsxfs_volume_open(
      libfsxfs_volume_t *volume,
@@ -170,6 +215,12 @@ int libfsxfs_volume_get_utf16_label(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_number_of_file_entries(
+     libfsxfs_volume_t *volume,
+     uint32_t *number_of_file_entries,
+     libcerror_error_t **error );
+
 int libfsxfs_internal_volume_get_root_directory(
      libfsxfs_internal_volume_t *internal_volume,
      libfsxfs_file_entry_t **file_entry,
@@ -224,6 +275,39 @@ int libfsxfs_volume_get_file_entry_by_utf16_path(
      libfsxfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_open_inode_scanner(
+     libfsxfs_volume_t *volume,
+     libfsxfs_inode_scanner_t **inode_scanner,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_scan_inodes(
+     libfsxfs_volume_t *volume,
+     int number_of_threads,
+     uint8_t scan_flags,
+     int (*callback_function)(
+            libfsxfs_inode_scanner_t *inode_scanner,
+            uint64_t inode_number,
+            void *callback_arguments ),
+     void *callback_arguments,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_inodes_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     libcerror_error_t **error );
+
+LIBFSXFS_EXTERN \
+int libfsxfs_volume_get_directory_entries_cache_statistics(
+     libfsxfs_volume_t *volume,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
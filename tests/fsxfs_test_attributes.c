@@ -38,9 +38,12 @@
 
 #include "../libfsxfs/libfsxfs_attribute_values.h"
 #include "../libfsxfs/libfsxfs_attributes.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_array.h"
 #include "../libfsxfs/libfsxfs_io_handle.h"
 #include "../libfsxfs/libfsxfs_inode.h"
 #include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_libfdata.h"
 
 /* Branch attributes block
  */
@@ -114,6 +117,107 @@ uint8_t fsxfs_test_attributes_block_data2[ 512 ] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 
+/* Attributes node block followed by 2 leaf blocks, where the name hash of the
+ * last entry of the first leaf block continues in the second leaf block
+ */
+uint8_t fsxfs_test_attributes_blocks_data3[ 1536 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01,
+	0x1c, 0x58, 0xf2, 0x37, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x9d, 0x39, 0x37, 0x00, 0x00, 0x00, 0x02,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xee, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30,
+	0x01, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1c, 0x38, 0x70, 0xb7, 0x01, 0xf0, 0x01, 0x00, 0x1c, 0x58, 0xf2, 0x34, 0x01, 0xe0, 0x01, 0x00,
+	0x1c, 0x58, 0xf2, 0x37, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x05, 0x05, 0x61, 0x62, 0x63, 0x64, 0x31, 0x66, 0x69, 0x72, 0x73, 0x74, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x05, 0x61, 0x62, 0x63, 0x64, 0x32, 0x66, 0x6f, 0x75, 0x72, 0x74, 0x68, 0x00, 0x00,
+	0x00, 0x05, 0x05, 0x61, 0x61, 0x61, 0x61, 0x31, 0x74, 0x68, 0x69, 0x72, 0x64, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xee, 0x00, 0x00, 0x00, 0x03, 0x00, 0x30,
+	0x01, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1c, 0x58, 0xf2, 0x37, 0x01, 0xf0, 0x01, 0x00, 0x1c, 0x58, 0xf2, 0xb7, 0x01, 0xe0, 0x01, 0x00,
+	0x1e, 0x9d, 0x39, 0x37, 0x01, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x05, 0x61, 0x74, 0x74, 0x72, 0x31, 0x73, 0x69, 0x78, 0x74, 0x68, 0x21, 0x00, 0x00,
+	0x00, 0x05, 0x05, 0x61, 0x62, 0x63, 0x65, 0x31, 0x66, 0x69, 0x66, 0x74, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x06, 0x05, 0x71, 0x62, 0x63, 0x64, 0x30, 0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 /* Tests the libfsxfs_attributes_read_branch_values function error paths
@@ -512,6 +616,7 @@ int fsxfs_test_attributes_read_leaf_values(
 	 */
 	result = libfsxfs_attributes_read_leaf_values(
 	          NULL,
+	          0,
 	          fsxfs_test_attributes_block_data2,
 	          512,
 	          extended_attributes_array,
@@ -531,6 +636,7 @@ int fsxfs_test_attributes_read_leaf_values(
 
 	result = libfsxfs_attributes_read_leaf_values(
 	          io_handle,
+	          0,
 	          NULL,
 	          512,
 	          extended_attributes_array,
@@ -550,6 +656,7 @@ int fsxfs_test_attributes_read_leaf_values(
 
 	result = libfsxfs_attributes_read_leaf_values(
 	          io_handle,
+	          0,
 	          fsxfs_test_attributes_block_data2,
 	          (size_t) SSIZE_MAX + 1,
 	          extended_attributes_array,
@@ -569,6 +676,7 @@ int fsxfs_test_attributes_read_leaf_values(
 
 	result = libfsxfs_attributes_read_leaf_values(
 	          io_handle,
+	          0,
 	          fsxfs_test_attributes_block_data2,
 	          512,
 	          NULL,
@@ -647,38 +755,1157 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+/* Tests the libfsxfs_attributes_get_leaf_entry_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_attributes_get_leaf_entry_values(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfsxfs_attribute_values_t *attribute_values = NULL;
+	int result                                    = 0;
 
-/* The main program
+	/* Test regular cases
+	 */
+	result = libfsxfs_attributes_get_leaf_entry_values(
+	          0,
+	          fsxfs_test_attributes_block_data2,
+	          512,
+	          0x0110,
+	          0x01,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "attribute_values->name_size",
+	 attribute_values->name_size,
+	 (size_t) 14 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attribute_values->value_data_size",
+	 attribute_values->value_data_size,
+	 (uint32_t) 21 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "attribute_values->value_data_location",
+	 attribute_values->value_data_location,
+	 (uint8_t) LIBFSXFS_VALUE_DATA_LOCATION_LEAF_BLOCK );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "attribute_values->value_data_offset",
+	 attribute_values->value_data_offset,
+	 (size_t) 0x011b );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values->value_data",
+	 attribute_values->value_data );
+
+	result = libfsxfs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_attributes_get_leaf_entry_values(
+	          0,
+	          NULL,
+	          512,
+	          0x0110,
+	          0x01,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_leaf_entry_values(
+	          0,
+	          fsxfs_test_attributes_block_data2,
+	          (size_t) SSIZE_MAX + 1,
+	          0x0110,
+	          0x01,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_leaf_entry_values(
+	          0,
+	          fsxfs_test_attributes_block_data2,
+	          512,
+	          512,
+	          0x01,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_leaf_entry_values(
+	          0,
+	          fsxfs_test_attributes_block_data2,
+	          512,
+	          0x0110,
+	          0x01,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_attributes_get_attribute_values_from_blocks_by_name function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-	   int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-	   wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-	   int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
-	   char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fsxfs_test_attributes_get_attribute_values_from_blocks_by_name(
+     void )
 {
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
-	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle              = NULL;
+	libcerror_error_t *error                      = NULL;
+	libfsxfs_attribute_values_t *attribute_values = NULL;
+	libfsxfs_extent_t *extent                     = NULL;
+	libfsxfs_inode_t *inode                       = NULL;
+	libfsxfs_io_handle_t *io_handle               = NULL;
+	int result                                    = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	FSXFS_TEST_RUN(
-	 "libfsxfs_attributes_read_branch_values",
-	 fsxfs_test_attributes_read_branch_values );
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FSXFS_TEST_RUN(
-	 "libfsxfs_attributes_read_leaf_values",
-	 fsxfs_test_attributes_read_leaf_values );
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	/* TODO add tests for libfsxfs_attributes_read_from_block */
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO add tests for libfsxfs_attributes_read_from_inode */
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 512;
+	io_handle->allocation_group_size                = 8192;
+	io_handle->number_of_relative_block_number_bits = 13;
 
-	/* TODO add tests for libfsxfs_attributes_get_value_data_stream */
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_initialize(
+	          &( inode->attributes_extents_array ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_append_extent(
+	          inode->attributes_extents_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 0;
+	extent->physical_block_number = 0;
+	extent->number_of_blocks      = 3;
+
+	/* Initialize file IO handle
+	 */
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_attributes_blocks_data3,
+	          1536,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "abcd1",
+	          5,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attribute_values->value_data_block_number",
+	 attribute_values->value_data_block_number,
+	 (uint32_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attribute_values->value_data_size",
+	 attribute_values->value_data_size,
+	 (uint32_t) 5 );
+
+	result = libfsxfs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name with the same name hash as the last entry of the first leaf block
+	 * that is stored in the second leaf block
+	 */
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "qbcd0",
+	          5,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attribute_values->value_data_block_number",
+	 attribute_values->value_data_block_number,
+	 (uint32_t) 2 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "attribute_values->value_data_size",
+	 attribute_values->value_data_size,
+	 (uint32_t) 6 );
+
+	result = libfsxfs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that is not stored with a name hash within the first leaf block
+	 */
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "abcd0",
+	          5,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a name that is not stored with a name hash beyond the last leaf block
+	 */
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "missing",
+	          7,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          NULL,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "abcd1",
+	          5,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          NULL,
+	          5,
+	          0,
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_attribute_values_from_blocks_by_name(
+	          io_handle,
+	          file_io_handle,
+	          inode,
+	          (uint8_t *) "abcd1",
+	          5,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_attributes_split_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_attributes_split_utf8_name(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t name_offset       = 0;
+	uint8_t namespace_flags  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_attributes_split_utf8_name(
+	          (uint8_t *) "trusted.myxattr1",
+	          16,
+	          &name_offset,
+	          &namespace_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "name_offset",
+	 name_offset,
+	 (size_t) 8 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "namespace_flags",
+	 namespace_flags,
+	 (uint8_t) 2 );
+
+	result = libfsxfs_attributes_split_utf8_name(
+	          (uint8_t *) "myxattr1",
+	          8,
+	          &name_offset,
+	          &namespace_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_attributes_split_utf8_name(
+	          NULL,
+	          16,
+	          &name_offset,
+	          &namespace_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_split_utf8_name(
+	          (uint8_t *) "trusted.myxattr1",
+	          (size_t) SSIZE_MAX + 1,
+	          &name_offset,
+	          &namespace_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_split_utf8_name(
+	          (uint8_t *) "trusted.myxattr1",
+	          16,
+	          NULL,
+	          &namespace_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_split_utf8_name(
+	          (uint8_t *) "trusted.myxattr1",
+	          16,
+	          &name_offset,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_attributes_get_value_data_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_attributes_get_value_data_stream(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfdata_stream_t *data_stream                = NULL;
+	libfsxfs_attribute_values_t *attribute_values = NULL;
+	libfsxfs_extent_t *extent                     = NULL;
+	libfsxfs_inode_t *inode                       = NULL;
+	libfsxfs_io_handle_t *io_handle               = NULL;
+	size64_t data_stream_size                     = 0;
+	int number_of_segments                        = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 5;
+	io_handle->block_size                           = 1024;
+	io_handle->allocation_group_size                = 8192;
+	io_handle->number_of_relative_block_number_bits = 13;
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_initialize(
+	          &( inode->attributes_extents_array ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_append_extent(
+	          inode->attributes_extents_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 1;
+	extent->physical_block_number = 64;
+	extent->number_of_blocks      = 3;
+
+	result = libfsxfs_attribute_values_initialize(
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_values->value_data_location     = LIBFSXFS_VALUE_DATA_LOCATION_REMOTE_BLOCKS;
+	attribute_values->value_data_block_number = 1;
+	attribute_values->value_data_size         = 2000;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_attributes_get_value_data_stream(
+	          io_handle,
+	          inode,
+	          attribute_values,
+	          &data_stream,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_stream",
+	 data_stream );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every remote value data block has a 56 byte header, hence 2000 bytes
+	 * of value data are stored in 3 blocks of 1024 bytes
+	 */
+	result = libfdata_stream_get_number_of_segments(
+	          data_stream,
+	          &number_of_segments,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 3 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_get_size(
+	          data_stream,
+	          &data_stream_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "data_stream_size",
+	 (uint64_t) data_stream_size,
+	 (uint64_t) 2000 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &data_stream,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_attributes_get_value_data_stream(
+	          NULL,
+	          inode,
+	          attribute_values,
+	          &data_stream,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_value_data_stream(
+	          io_handle,
+	          inode,
+	          NULL,
+	          &data_stream,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_attributes_get_value_data_stream(
+	          io_handle,
+	          inode,
+	          attribute_values,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the value data is beyond the attributes extents
+	 */
+	attribute_values->value_data_size = 4000;
+
+	result = libfsxfs_attributes_get_value_data_stream(
+	          io_handle,
+	          inode,
+	          attribute_values,
+	          &data_stream,
+	          &error );
+
+	attribute_values->value_data_size = 2000;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "data_stream",
+	 data_stream );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_attribute_values_free(
+	          &attribute_values,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "attribute_values",
+	 attribute_values );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+	}
+	if( attribute_values != NULL )
+	{
+		libfsxfs_attribute_values_free(
+		 &attribute_values,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+	   int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+	   wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+	   int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+	   char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_read_branch_values",
+	 fsxfs_test_attributes_read_branch_values );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_read_leaf_values",
+	 fsxfs_test_attributes_read_leaf_values );
+
+	/* TODO add tests for libfsxfs_attributes_read_block */
+
+	/* TODO add tests for libfsxfs_attributes_read_from_block */
+
+	/* TODO add tests for libfsxfs_attributes_read_from_inode */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_get_leaf_entry_values",
+	 fsxfs_test_attributes_get_leaf_entry_values );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_get_attribute_values_from_blocks_by_name",
+	 fsxfs_test_attributes_get_attribute_values_from_blocks_by_name );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_split_utf8_name",
+	 fsxfs_test_attributes_split_utf8_name );
+
+	/* TODO add tests for libfsxfs_attributes_get_attribute_values_from_inode_by_utf8_name */
+
+	/* TODO add tests for libfsxfs_attributes_get_attribute_values_from_inode_by_utf16_name */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_attributes_get_value_data_stream",
+	 fsxfs_test_attributes_get_value_data_stream );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
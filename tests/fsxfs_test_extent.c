@@ -270,6 +270,182 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_extent_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_clone(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_t *destination_extent = NULL;
+	libfsxfs_extent_t *source_extent      = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_initialize(
+	          &source_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_extent",
+	 source_extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_extent->logical_block_number  = 2;
+	source_extent->physical_block_number = 1024;
+	source_extent->number_of_blocks      = 8;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_clone(
+	          &destination_extent,
+	          source_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_extent",
+	 destination_extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_extent->physical_block_number",
+	 destination_extent->physical_block_number,
+	 (uint64_t) 1024 );
+
+	result = libfsxfs_extent_free(
+	          &destination_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_extent",
+	 destination_extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_clone(
+	          &destination_extent,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_extent",
+	 destination_extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_clone(
+	          NULL,
+	          source_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_extent = (libfsxfs_extent_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_clone(
+	          &destination_extent,
+	          source_extent,
+	          &error );
+
+	destination_extent = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_free(
+	          &source_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "source_extent",
+	 source_extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &destination_extent,
+		 NULL );
+	}
+	if( source_extent != NULL )
+	{
+		libfsxfs_extent_free(
+		 &source_extent,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +473,10 @@ int main(
 	 "libfsxfs_extent_free",
 	 fsxfs_test_extent_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_clone",
+	 fsxfs_test_extent_clone );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,968 @@
+/*
+ * Library extent_array type test program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent_array.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_extent_array_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_array_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_array_t *extent_array = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_array_initialize(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_free(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_array_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_array = (libfsxfs_extent_array_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_array_initialize(
+	          &extent_array,
+	          &error );
+
+	extent_array = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_array_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_array_initialize(
+		          &extent_array,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_array != NULL )
+			{
+				libfsxfs_extent_array_free(
+				 &extent_array,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_array",
+			 extent_array );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_array_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_array_initialize(
+		          &extent_array,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( extent_array != NULL )
+			{
+				libfsxfs_extent_array_free(
+				 &extent_array,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_array",
+			 extent_array );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &extent_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_array_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_array_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_array_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_array_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_array_truncate(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_array_t *extent_array = NULL;
+	libfsxfs_extent_t *extent             = NULL;
+	int extent_index                      = 0;
+	int number_of_extents                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_array_initialize(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 8;
+	     extent_index++ )
+	{
+		extent = NULL;
+
+		result = libfsxfs_extent_array_append_extent(
+		          extent_array,
+		          &extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "extent",
+		 extent );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent->logical_block_number  = (uint64_t) extent_index * 8;
+		extent->physical_block_number = 1024 + ( (uint64_t) extent_index * 16 );
+		extent->number_of_blocks      = 8;
+	}
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_array_truncate(
+	          extent_array,
+	          5,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_get_number_of_extents(
+	          extent_array,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 5 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_get_last_extent(
+	          extent_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->logical_block_number",
+	 extent->logical_block_number,
+	 (uint64_t) 32 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_array_truncate(
+	          NULL,
+	          5,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_truncate(
+	          extent_array,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_truncate(
+	          extent_array,
+	          6,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_array_free(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &extent_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_array_append_extent function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_array_append_extent(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_array_t *extent_array = NULL;
+	libfsxfs_extent_t *extent             = NULL;
+	int extent_index                      = 0;
+	int number_of_extents                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_array_initialize(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( extent_index = 0;
+	     extent_index < 64;
+	     extent_index++ )
+	{
+		extent = NULL;
+
+		result = libfsxfs_extent_array_append_extent(
+		          extent_array,
+		          &extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "extent",
+		 extent );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		extent->logical_block_number  = (uint64_t) extent_index * 8;
+		extent->physical_block_number = 1024 + ( (uint64_t) extent_index * 16 );
+		extent->number_of_blocks      = 8;
+	}
+	result = libfsxfs_extent_array_get_number_of_extents(
+	          extent_array,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 64 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_get_extent_by_index(
+	          extent_array,
+	          32,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->physical_block_number",
+	 extent->physical_block_number,
+	 (uint64_t) 1536 );
+
+	result = libfsxfs_extent_array_get_last_extent(
+	          extent_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "extent->logical_block_number",
+	 extent->logical_block_number,
+	 (uint64_t) 504 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_array_append_extent(
+	          NULL,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_append_extent(
+	          extent_array,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_get_extent_by_index(
+	          extent_array,
+	          64,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_array_free(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &extent_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_array_get_extent_by_logical_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_array_get_extent_by_logical_block_number(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_array_t *extent_array = NULL;
+	libfsxfs_extent_t *extent             = NULL;
+	int extent_index                      = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_array_initialize(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_append_extent(
+	          extent_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 0;
+	extent->physical_block_number = 1024;
+	extent->number_of_blocks      = 8;
+
+	result = libfsxfs_extent_array_append_extent(
+	          extent_array,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	extent->logical_block_number  = 16;
+	extent->physical_block_number = 2048;
+	extent->number_of_blocks      = 8;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          extent_array,
+	          20,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          extent_array,
+	          8,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "extent_index",
+	 extent_index,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent",
+	 extent );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          NULL,
+	          20,
+	          &extent_index,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          extent_array,
+	          20,
+	          NULL,
+	          &extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_array_get_extent_by_logical_block_number(
+	          extent_array,
+	          20,
+	          &extent_index,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_array_free(
+	          &extent_array,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_array",
+	 extent_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_array != NULL )
+	{
+		libfsxfs_extent_array_free(
+		 &extent_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_array_initialize",
+	 fsxfs_test_extent_array_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_array_free",
+	 fsxfs_test_extent_array_free );
+
+	/* TODO: add tests for libfsxfs_extent_array_clone */
+
+	/* TODO: add tests for libfsxfs_extent_array_empty */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_array_truncate",
+	 fsxfs_test_extent_array_truncate );
+
+	/* TODO: add tests for libfsxfs_extent_array_reserve */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_array_append_extent",
+	 fsxfs_test_extent_array_append_extent );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_array_get_extent_by_logical_block_number",
+	 fsxfs_test_extent_array_get_extent_by_logical_block_number );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
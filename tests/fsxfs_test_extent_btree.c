@@ -0,0 +1,721 @@
+/*
+ * Library extent_btree type test program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_btree.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_extent_btree_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extent_btree = (libfsxfs_extent_btree_t *) 0x12345678UL;
+
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	extent_btree = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_btree_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_btree_initialize(
+		          &extent_btree,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( extent_btree != NULL )
+			{
+				libfsxfs_extent_btree_free(
+				 &extent_btree,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_btree",
+			 extent_btree );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_extent_btree_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_extent_btree_initialize(
+		          &extent_btree,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( extent_btree != NULL )
+			{
+				libfsxfs_extent_btree_free(
+				 &extent_btree,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "extent_btree",
+			 extent_btree );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_get_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_get_reference(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_extent_btree_t *destination_extent_btree = NULL;
+	libfsxfs_extent_btree_t *source_extent_btree      = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          &source_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_extent_btree",
+	 source_extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "source_extent_btree->number_of_references",
+	 source_extent_btree->number_of_references,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_extent_btree_get_reference(
+	          &destination_extent_btree,
+	          source_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_extent_btree",
+	 (intptr_t) destination_extent_btree,
+	 (intptr_t) source_extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "source_extent_btree->number_of_references",
+	 source_extent_btree->number_of_references,
+	 2 );
+
+	/* Freeing a reference should keep the blocks cache of the other reference
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &source_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "source_extent_btree",
+	 source_extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "destination_extent_btree->number_of_references",
+	 destination_extent_btree->number_of_references,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_extent_btree->blocks_cache",
+	 destination_extent_btree->blocks_cache );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_get_reference(
+	          NULL,
+	          destination_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_reference(
+	          &destination_extent_btree,
+	          destination_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_reference(
+	          &source_extent_btree,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &destination_extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_extent_btree",
+	 destination_extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &destination_extent_btree,
+		 NULL );
+	}
+	if( source_extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &source_extent_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_extent_btree_get_extent_by_logical_block_number function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_extent_btree_get_extent_by_logical_block_number(
+     void )
+{
+	uint8_t root_node_data[ 20 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_btree_t *extent_btree = NULL;
+	libfsxfs_extent_t extent;
+	uint64_t next_logical_block_number    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_extent_btree_initialize(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          NULL,
+	          NULL,
+	          NULL,
+	          root_node_data,
+	          20,
+	          0,
+	          &extent,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          extent_btree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          20,
+	          0,
+	          &extent,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          extent_btree,
+	          NULL,
+	          NULL,
+	          root_node_data,
+	          2,
+	          0,
+	          &extent,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          extent_btree,
+	          NULL,
+	          NULL,
+	          root_node_data,
+	          20,
+	          0,
+	          NULL,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          extent_btree,
+	          NULL,
+	          NULL,
+	          root_node_data,
+	          20,
+	          0,
+	          &extent,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test get extent with unsupported root node level
+	 */
+	result = libfsxfs_extent_btree_get_extent_by_logical_block_number(
+	          extent_btree,
+	          NULL,
+	          NULL,
+	          root_node_data,
+	          20,
+	          0,
+	          &extent,
+	          &next_logical_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_extent_btree_free(
+	          &extent_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extent_btree",
+	 extent_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extent_btree != NULL )
+	{
+		libfsxfs_extent_btree_free(
+		 &extent_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_initialize",
+	 fsxfs_test_extent_btree_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_free",
+	 fsxfs_test_extent_btree_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_get_reference",
+	 fsxfs_test_extent_btree_get_reference );
+
+	/* TODO: add tests for libfsxfs_extent_btree_get_extents_from_root_node */
+
+	/* TODO: add tests for libfsxfs_extent_btree_get_node */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_extent_btree_get_extent_by_logical_block_number",
+	 fsxfs_test_extent_btree_get_extent_by_logical_block_number );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
@@ -21,19 +21,50 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_libbfio.h"
 #include "fsxfs_test_libcerror.h"
 #include "fsxfs_test_libfsxfs.h"
 #include "fsxfs_test_macros.h"
 #include "fsxfs_test_memory.h"
 #include "fsxfs_test_unused.h"
 
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_array.h"
 #include "../libfsxfs/libfsxfs_file_entry.h"
+#include "../libfsxfs/libfsxfs_file_system.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* Data of the volume that contains the extents of the regular files
+ */
+uint8_t fsxfs_test_file_entry_data1[ 9216 ];
+
+/* Extents of a regular file with a hole of 2 blocks between the extents
+ * The values are the logical block number, physical block number,
+ * number of blocks and range flags of each extent
+ */
+uint64_t fsxfs_test_file_entry_extents_values1[ 2 ][ 4 ] = {
+	{ 0, 4, 2, 0 },
+	{ 4, 16, 2, 0 } };
+
+/* Extents of a regular file of which the first 2 extents are logically
+ * and physically adjacent, the third extent is not physically adjacent
+ * and the fourth extent is physically adjacent but unwritten
+ */
+uint64_t fsxfs_test_file_entry_extents_values2[ 4 ][ 4 ] = {
+	{ 0, 4, 2, 0 },
+	{ 2, 6, 2, 0 },
+	{ 4, 20, 2, 0 },
+	{ 6, 22, 2, LIBFSXFS_EXTENT_FLAG_IS_SPARSE } };
 
 /* Tests the libfsxfs_file_entry_free function
  * Returns 1 if successful or 0 if not
@@ -46,8 +77,1055 @@ int fsxfs_test_file_entry_free(
 
 	/* Test error cases
 	 */
-	result = libfsxfs_file_entry_free(
+	result = libfsxfs_file_entry_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates a file entry of a regular file for testing
+ * The file entry contains inline data if extents values is NULL
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_file_entry_create(
+     libfsxfs_file_entry_t **file_entry,
+     libfsxfs_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libfsxfs_file_system_t *file_system,
+     uint64_t size,
+     uint64_t extents_values[][ 4 ],
+     int number_of_extents,
+     libcerror_error_t **error )
+{
+	libfsxfs_extent_t *extent = NULL;
+	libfsxfs_inode_t *inode   = NULL;
+	static char *function     = "fsxfs_test_file_entry_create";
+	size_t data_offset        = 0;
+	int extent_index          = 0;
+
+	if( libfsxfs_inode_initialize(
+	     &inode,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	inode->file_mode       = LIBFSXFS_FILE_TYPE_REGULAR_FILE | 0x01a4;
+	inode->number_of_links = 1;
+	inode->size            = size;
+
+	if( extents_values == NULL )
+	{
+		/* The inline data is stored after the version 3 inode core
+		 */
+		for( data_offset = 176;
+		     data_offset < 256;
+		     data_offset++ )
+		{
+			inode->data[ data_offset ] = (uint8_t) ( data_offset - 176 );
+		}
+		inode->fork_type   = LIBFSXFS_FORK_TYPE_INLINE_DATA;
+		inode->inline_data = &( inode->data[ 176 ] );
+	}
+	else
+	{
+		inode->fork_type              = LIBFSXFS_FORK_TYPE_EXTENTS;
+		inode->number_of_data_extents = (uint64_t) number_of_extents;
+
+		if( libfsxfs_extent_array_initialize(
+		     &( inode->data_extents_array ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data extents array.",
+			 function );
+
+			goto on_error;
+		}
+		for( extent_index = 0;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			extent = NULL;
+
+			if( libfsxfs_extent_array_append_extent(
+			     inode->data_extents_array,
+			     &extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append data extent: %d.",
+				 function,
+				 extent_index );
+
+				goto on_error;
+			}
+			extent->logical_block_number  = extents_values[ extent_index ][ 0 ];
+			extent->physical_block_number = extents_values[ extent_index ][ 1 ];
+			extent->number_of_blocks      = (uint32_t) extents_values[ extent_index ][ 2 ];
+			extent->range_flags           = (uint32_t) extents_values[ extent_index ][ 3 ];
+		}
+	}
+	/* The file entry takes over management of the inode
+	 */
+	if( libfsxfs_file_entry_initialize(
+	     file_entry,
+	     io_handle,
+	     file_io_handle,
+	     file_system,
+	     128,
+	     inode,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libfsxfs_file_entry_pread_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_pread_buffer(
+     void )
+{
+	uint8_t buffer[ 1024 ];
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfsxfs_file_entry_t *file_entry        = NULL;
+	libfsxfs_file_entry_t *inline_file_entry = NULL;
+	libfsxfs_file_system_t *file_system      = NULL;
+	libfsxfs_io_handle_t *io_handle          = NULL;
+	size_t buffer_offset                     = 0;
+	size_t data_offset                       = 0;
+	ssize_t read_count                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 9216;
+	     data_offset++ )
+	{
+		fsxfs_test_file_entry_data1[ data_offset ] = (uint8_t) ( ( data_offset % 255 ) + 1 );
+	}
+	result = fsxfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsxfs_test_file_entry_data1,
+	          9216,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 512;
+	io_handle->allocation_group_size                = 8192;
+	io_handle->number_of_relative_block_number_bits = 13;
+
+	result = libfsxfs_file_system_initialize(
+	          &file_system,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_file_entry_create(
+	          &file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          2660,
+	          fsxfs_test_file_entry_extents_values1,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_file_entry_create(
+	          &inline_file_entry,
+	          io_handle,
+	          file_io_handle,
+	          file_system,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Read the end of the first extent and the start of the hole between
+	 * the extents, the hole is filled with zero bytes
+	 */
+	memory_set(
+	 buffer,
+	 0xff,
+	 1024 );
+
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          file_entry,
+	          buffer,
+	          1024,
+	          100,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 1024 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( fsxfs_test_file_entry_data1[ 2148 ] ),
+	          924 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( buffer_offset = 924;
+	     buffer_offset < 1024;
+	     buffer_offset++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 (uint8_t) 0 );
+	}
+	/* Read the end of the data, the read is clamped to the end of the data
+	 */
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          file_entry,
+	          buffer,
+	          512,
+	          2548,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 112 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( fsxfs_test_file_entry_data1[ 8692 ] ),
+	          112 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Read at the end of the data
+	 */
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          file_entry,
+	          buffer,
+	          512,
+	          2660,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Read inline data, the read is clamped to the end of the data
+	 */
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          inline_file_entry,
+	          buffer,
+	          64,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 12 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( buffer_offset = 0;
+	     buffer_offset < 12;
+	     buffer_offset++ )
+	{
+		FSXFS_TEST_ASSERT_EQUAL_UINT8(
+		 "buffer[ buffer_offset ]",
+		 buffer[ buffer_offset ],
+		 (uint8_t) ( buffer_offset + 4 ) );
+	}
+	/* Test error cases
+	 */
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          NULL,
+	          buffer,
+	          512,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          file_entry,
+	          buffer,
+	          512,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsxfs_file_entry_pread_buffer(
+	          file_entry,
+	          NULL,
+	          512,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_file_entry_free(
+	          &inline_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inline_file_entry",
+	 inline_file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inline_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &inline_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_file_entry_map_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_file_entry_map_range(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfsxfs_file_entry_t *adjacent_file_entry = NULL;
+	libfsxfs_file_entry_t *file_entry          = NULL;
+	libfsxfs_file_entry_t *inline_file_entry   = NULL;
+	libfsxfs_file_system_t *file_system        = NULL;
+	libfsxfs_io_handle_t *io_handle            = NULL;
+	off64_t physical_offset                    = 0;
+	size64_t mapped_size                       = 0;
+	uint32_t range_flags                       = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version                       = 4;
+	io_handle->block_size                           = 512;
+	io_handle->allocation_group_size                = 8192;
+	io_handle->number_of_relative_block_number_bits = 13;
+
+	result = libfsxfs_file_system_initialize(
+	          &file_system,
+	          128,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_file_entry_create(
+	          &file_entry,
+	          io_handle,
+	          NULL,
+	          file_system,
+	          2660,
+	          fsxfs_test_file_entry_extents_values1,
+	          2,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_file_entry_create(
+	          &adjacent_file_entry,
+	          io_handle,
+	          NULL,
+	          file_system,
+	          4096,
+	          fsxfs_test_file_entry_extents_values2,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_file_entry_create(
+	          &inline_file_entry,
+	          io_handle,
+	          NULL,
+	          file_system,
+	          16,
+	          NULL,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Offset inside the first block of the first extent
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          100,
+	          4096,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 2148 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 924 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) 0 );
+
+	/* Offset inside the hole between the extents, which is mapped
+	 * as sparse up to the next extent
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          1034,
+	          4096,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 1014 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) LIBFSXFS_EXTENT_FLAG_IS_SPARSE );
+
+	/* Offset inside the last block of the second extent, the mapped size
+	 * is clamped to the end of the data
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          2610,
+	          4096,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 8754 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 50 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) 0 );
+
+	/* Offset at the end of the data
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          2660,
+	          512,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Offset inside the first extent, the mapped size continues
+	 * into the logically and physically adjacent second extent
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          adjacent_file_entry,
+	          512,
+	          1024,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 2560 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) 0 );
+
+	/* The mapped size spans the first and second extent and stops
+	 * at the physical discontinuity with the third extent
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          adjacent_file_entry,
+	          0,
+	          4096,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 2048 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 2048 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) 0 );
+
+	/* The mapped size stops at the range flags change between
+	 * the third and the fourth extent
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          adjacent_file_entry,
+	          2048,
+	          2048,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 10240 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) 0 );
+
+	/* Offset inside the unwritten fourth extent, which is mapped as sparse
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          adjacent_file_entry,
+	          3072,
+	          1024,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 1024 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) LIBFSXFS_EXTENT_FLAG_IS_SPARSE );
+
+	/* Inline data
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          inline_file_entry,
+	          4,
+	          64,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "physical_offset",
+	 physical_offset,
+	 (int64_t) 0 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_size",
+	 mapped_size,
+	 (uint64_t) 12 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "range_flags",
+	 range_flags,
+	 (uint32_t) LIBFSXFS_EXTENT_FLAG_IS_INLINE );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_file_entry_map_range(
+	          NULL,
+	          0,
+	          512,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          -1,
+	          512,
+	          &physical_offset,
+	          &mapped_size,
+	          &range_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_file_entry_map_range(
+	          file_entry,
+	          0,
+	          512,
 	          NULL,
+	          &mapped_size,
+	          &range_flags,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +1140,93 @@ int fsxfs_test_file_entry_free(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = libfsxfs_file_entry_free(
+	          &inline_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inline_file_entry",
+	 inline_file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &adjacent_file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "adjacent_file_entry",
+	 adjacent_file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_entry_free(
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_file_system_free(
+	          &file_system,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_system",
+	 file_system );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +1235,39 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( inline_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &inline_file_entry,
+		 NULL );
+	}
+	if( adjacent_file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &adjacent_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( file_system != NULL )
+	{
+		libfsxfs_file_system_free(
+		 &file_system,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
-
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -148,6 +1341,10 @@ int main(
 
 	/* TODO: add tests for libfsxfs_file_entry_read_buffer_at_offset */
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_pread_buffer",
+	 fsxfs_test_file_entry_pread_buffer );
+
 	/* TODO: add tests for libfsxfs_file_entry_seek_offset */
 
 	/* TODO: add tests for libfsxfs_file_entry_get_offset */
@@ -158,6 +1355,10 @@ int main(
 
 	/* TODO: add tests for libfsxfs_file_entry_get_extent_by_index */
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_file_entry_map_range",
+	 fsxfs_test_file_entry_map_range );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
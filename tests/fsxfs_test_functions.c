@@ -30,6 +30,8 @@
 #include <stdlib.h>
 #endif
 
+#include <time.h>
+
 #include "fsxfs_test_libbfio.h"
 #include "fsxfs_test_libcerror.h"
 #include "fsxfs_test_libclocale.h"
@@ -670,3 +672,72 @@ int fsxfs_test_close_file_io_handle(
 	return( result );
 }
 
+/* Retrieves a monotonic time value in micro seconds for benchmarking
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_get_time_in_microseconds(
+     uint64_t *microseconds,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+#endif
+
+	static char *function = "fsxfs_test_get_time_in_microseconds";
+
+	if( microseconds == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid micro seconds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*microseconds = (uint64_t) ( ( counter.QuadPart / frequency.QuadPart ) * 1000000 )
+	              + (uint64_t) ( ( ( counter.QuadPart % frequency.QuadPart ) * 1000000 ) / frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock.",
+		 function );
+
+		return( -1 );
+	}
+	*microseconds = ( (uint64_t) time_value.tv_sec * 1000000 ) + ( (uint64_t) time_value.tv_nsec / 1000 );
+
+#else
+	*microseconds = ( (uint64_t) clock() * 1000000 ) / CLOCKS_PER_SEC;
+
+#endif
+	return( 1 );
+}
+
@@ -64,6 +64,10 @@ int fsxfs_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int fsxfs_test_get_time_in_microseconds(
+     uint64_t *microseconds,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
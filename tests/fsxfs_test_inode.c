@@ -0,0 +1,1027 @@
+/*
+ * Library inode type test program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_memory.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_extent.h"
+#include "../libfsxfs/libfsxfs_extent_array.h"
+#include "../libfsxfs/libfsxfs_extent_btree.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_inode_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfsxfs_inode_t *inode  = NULL;
+	int result               = 0;
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_free(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_initialize(
+	          NULL,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode = (libfsxfs_inode_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          256,
+	          &error );
+
+	inode = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_initialize(
+	          &inode,
+	          100,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSXFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_initialize with malloc failing
+		 */
+		fsxfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_initialize(
+		          &inode,
+		          256,
+		          &error );
+
+		if( fsxfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsxfs_test_malloc_attempts_before_fail = -1;
+
+			if( inode != NULL )
+			{
+				libfsxfs_inode_free(
+				 &inode,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode",
+			 inode );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsxfs_inode_initialize with memset failing
+		 */
+		fsxfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsxfs_inode_initialize(
+		          &inode,
+		          256,
+		          &error );
+
+		if( fsxfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsxfs_test_memset_attempts_before_fail = -1;
+
+			if( inode != NULL )
+			{
+				libfsxfs_inode_free(
+				 &inode,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSXFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSXFS_TEST_ASSERT_IS_NULL(
+			 "inode",
+			 inode );
+
+			FSXFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSXFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_free(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_clone(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_extent_t *destination_extent = NULL;
+	libfsxfs_extent_t *source_extent      = NULL;
+	libfsxfs_inode_t *destination_inode   = NULL;
+	libfsxfs_inode_t *source_inode        = NULL;
+	size_t data_offset                    = 0;
+	int extent_index                      = 0;
+	int number_of_extents                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_initialize(
+	          &source_inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_inode",
+	 source_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		source_inode->data[ data_offset ] = (uint8_t) data_offset;
+	}
+	source_inode->format_version         = 3;
+	source_inode->file_mode              = 0x81a4;
+	source_inode->number_of_links        = 1;
+	source_inode->size                   = 32768;
+	source_inode->inline_data            = &( source_inode->data[ 176 ] );
+	source_inode->inline_attributes_data = &( source_inode->data[ 224 ] );
+	source_inode->number_of_data_extents = 2;
+
+	result = libfsxfs_extent_array_initialize(
+	          &( source_inode->data_extents_array ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 2;
+	     extent_index++ )
+	{
+		source_extent = NULL;
+
+		result = libfsxfs_extent_array_append_extent(
+		          source_inode->data_extents_array,
+		          &source_extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NOT_NULL(
+		 "source_extent",
+		 source_extent );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		source_extent->logical_block_number  = (uint64_t) extent_index * 4;
+		source_extent->physical_block_number = 1024 + ( (uint64_t) extent_index * 64 );
+		source_extent->number_of_blocks      = 4;
+		source_extent->range_flags           = 0;
+	}
+	result = libfsxfs_extent_btree_initialize(
+	          &( source_inode->data_extent_btree ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_clone(
+	          &destination_inode,
+	          source_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_inode",
+	 destination_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_inode->format_version",
+	 destination_inode->format_version,
+	 (uint8_t) 3 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "destination_inode->file_mode",
+	 destination_inode->file_mode,
+	 (uint16_t) 0x81a4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_inode->number_of_links",
+	 destination_inode->number_of_links,
+	 (uint32_t) 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_inode->size",
+	 destination_inode->size,
+	 (uint64_t) 32768 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_inode->data_size",
+	 destination_inode->data_size,
+	 (size_t) 256 );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "destination_inode->data",
+	 (intptr_t) destination_inode->data,
+	 (intptr_t) source_inode->data );
+
+	result = memory_compare(
+	          destination_inode->data,
+	          source_inode->data,
+	          256 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The inline data should reference the data of the destination inode
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_inode->inline_data",
+	 (intptr_t) destination_inode->inline_data,
+	 (intptr_t) &( destination_inode->data[ 176 ] ) );
+
+	FSXFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_inode->inline_attributes_data",
+	 (intptr_t) destination_inode->inline_attributes_data,
+	 (intptr_t) &( destination_inode->data[ 224 ] ) );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_inode->data_extents_array",
+	 destination_inode->data_extents_array );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "destination_inode->data_extents_array",
+	 (intptr_t) destination_inode->data_extents_array,
+	 (intptr_t) source_inode->data_extents_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode->attributes_extents_array",
+	 destination_inode->attributes_extents_array );
+
+	result = libfsxfs_extent_array_get_number_of_extents(
+	          destination_inode->data_extents_array,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 2 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( extent_index = 0;
+	     extent_index < 2;
+	     extent_index++ )
+	{
+		result = libfsxfs_extent_array_get_extent_by_index(
+		          source_inode->data_extents_array,
+		          extent_index,
+		          &source_extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfsxfs_extent_array_get_extent_by_index(
+		          destination_inode->data_extents_array,
+		          extent_index,
+		          &destination_extent,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+		 "destination_extent",
+		 (intptr_t) destination_extent,
+		 (intptr_t) source_extent );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "destination_extent->logical_block_number",
+		 destination_extent->logical_block_number,
+		 source_extent->logical_block_number );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT64(
+		 "destination_extent->physical_block_number",
+		 destination_extent->physical_block_number,
+		 source_extent->physical_block_number );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT32(
+		 "destination_extent->number_of_blocks",
+		 destination_extent->number_of_blocks,
+		 source_extent->number_of_blocks );
+
+		FSXFS_TEST_ASSERT_EQUAL_UINT32(
+		 "destination_extent->range_flags",
+		 destination_extent->range_flags,
+		 source_extent->range_flags );
+	}
+	/* The data extent B+ tree and its cached nodes should be shared
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_inode->data_extent_btree",
+	 (intptr_t) destination_inode->data_extent_btree,
+	 (intptr_t) source_inode->data_extent_btree );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "destination_inode->data_extent_btree->number_of_references",
+	 destination_inode->data_extent_btree->number_of_references,
+	 2 );
+
+	/* The destination inode should remain valid after the source inode is freed
+	 */
+	result = libfsxfs_inode_free(
+	          &source_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_inode->inline_data[ 0 ]",
+	 destination_inode->inline_data[ 0 ],
+	 (uint8_t) 176 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_inode->data_extent_btree",
+	 destination_inode->data_extent_btree );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "destination_inode->data_extent_btree->number_of_references",
+	 destination_inode->data_extent_btree->number_of_references,
+	 1 );
+
+	result = libfsxfs_inode_free(
+	          &destination_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode",
+	 destination_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_clone(
+	          &destination_inode,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode",
+	 destination_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_clone(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_inode = (libfsxfs_inode_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_clone(
+	          &destination_inode,
+	          NULL,
+	          &error );
+
+	destination_inode = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &destination_inode,
+		 NULL );
+	}
+	if( source_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &source_inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_clone_attributes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_clone_attributes(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_extent_t *source_extent    = NULL;
+	libfsxfs_inode_t *destination_inode = NULL;
+	libfsxfs_inode_t *source_inode      = NULL;
+	size_t data_offset                  = 0;
+	int number_of_extents               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_initialize(
+	          &source_inode,
+	          256,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_inode",
+	 source_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 256;
+	     data_offset++ )
+	{
+		source_inode->data[ data_offset ] = (uint8_t) data_offset;
+	}
+	source_inode->file_mode              = 0x81a4;
+	source_inode->size                   = 32768;
+	source_inode->inline_data            = &( source_inode->data[ 176 ] );
+	source_inode->attributes_fork_type   = LIBFSXFS_FORK_TYPE_INLINE_DATA;
+	source_inode->inline_attributes_data = &( source_inode->data[ 224 ] );
+	source_inode->attributes_fork_size   = 32;
+
+	result = libfsxfs_extent_array_initialize(
+	          &( source_inode->data_extents_array ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_initialize(
+	          &( source_inode->attributes_extents_array ),
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extent_array_append_extent(
+	          source_inode->attributes_extents_array,
+	          &source_extent,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_extent->logical_block_number  = 0;
+	source_extent->physical_block_number = 2048;
+	source_extent->number_of_blocks      = 1;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_clone_attributes(
+	          &destination_inode,
+	          source_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_inode",
+	 destination_inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT16(
+	 "destination_inode->file_mode",
+	 destination_inode->file_mode,
+	 (uint16_t) 0x81a4 );
+
+	/* Only the inline attributes data should be copied
+	 */
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "destination_inode->data_size",
+	 destination_inode->data_size,
+	 (size_t) 32 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INTPTR(
+	 "destination_inode->inline_attributes_data",
+	 (intptr_t) destination_inode->inline_attributes_data,
+	 (intptr_t) destination_inode->data );
+
+	result = memory_compare(
+	          destination_inode->inline_attributes_data,
+	          source_inode->inline_attributes_data,
+	          32 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode->inline_data",
+	 destination_inode->inline_data );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode->data_extents_array",
+	 destination_inode->data_extents_array );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "destination_inode->data_extent_btree",
+	 destination_inode->data_extent_btree );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "destination_inode->attributes_extents_array",
+	 (intptr_t) destination_inode->attributes_extents_array,
+	 (intptr_t) source_inode->attributes_extents_array );
+
+	result = libfsxfs_extent_array_get_number_of_extents(
+	          destination_inode->attributes_extents_array,
+	          &number_of_extents,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The destination inode should remain valid after the source inode is freed
+	 */
+	result = libfsxfs_inode_free(
+	          &source_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_inode->inline_attributes_data[ 0 ]",
+	 destination_inode->inline_attributes_data[ 0 ],
+	 (uint8_t) 224 );
+
+	result = libfsxfs_inode_free(
+	          &destination_inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_clone_attributes(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_inode = (libfsxfs_inode_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_clone_attributes(
+	          &destination_inode,
+	          NULL,
+	          &error );
+
+	destination_inode = NULL;
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &destination_inode,
+		 NULL );
+	}
+	if( source_inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &source_inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_initialize",
+	 fsxfs_test_inode_initialize );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_free",
+	 fsxfs_test_inode_free );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_clone",
+	 fsxfs_test_inode_clone );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_clone_attributes",
+	 fsxfs_test_inode_clone_attributes );
+
+	/* TODO: add tests for libfsxfs_inode_read_data */
+
+	/* TODO: add tests for libfsxfs_inode_read_file_io_handle */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+}
+
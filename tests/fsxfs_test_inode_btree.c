@@ -34,9 +34,18 @@
 #include "fsxfs_test_unused.h"
 
 #include "../libfsxfs/libfsxfs_inode_btree.h"
+#include "../libfsxfs/libfsxfs_inode_btree_record.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
+uint8_t fsxfs_test_inode_btree_leaf_records_data1[ 48 ] = {
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fsxfs_test_inode_btree_branch_records_data1[ 16 ] = {
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09 };
+
 /* Tests the libfsxfs_inode_btree_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -270,6 +279,627 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_inode_btree_set_number_of_allocation_groups function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_set_number_of_allocation_groups(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_btree_t *inode_btree = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_btree->number_of_allocation_groups",
+	 inode_btree->number_of_allocation_groups,
+	 (uint32_t) 4 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT64(
+	 "inode_btree->inode_information_offset",
+	 (int64_t) inode_btree->inode_information_offset,
+	 (int64_t) 1024 );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          NULL,
+	          4,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          0,
+	          1024,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_set_number_of_allocation_groups(
+	          inode_btree,
+	          4,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_btree_get_sub_node_from_branch_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_get_sub_node_from_branch_node(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsxfs_inode_btree_t *inode_btree = NULL;
+	uint32_t relative_sub_block_number  = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          2,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x83,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_sub_block_number",
+	 relative_sub_block_number,
+	 (uint32_t) 5 );
+
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          2,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x140,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "relative_sub_block_number",
+	 relative_sub_block_number,
+	 (uint32_t) 9 );
+
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          2,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x20,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          NULL,
+	          2,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x83,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          2,
+	          NULL,
+	          16,
+	          0x83,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x83,
+	          &relative_sub_block_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_sub_node_from_branch_node(
+	          inode_btree,
+	          2,
+	          fsxfs_test_inode_btree_branch_records_data1,
+	          16,
+	          0x83,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_btree_get_inode_from_leaf_node function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_btree_get_inode_from_leaf_node(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_inode_btree_t *inode_btree               = NULL;
+	libfsxfs_inode_btree_record_t *inode_btree_record = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_inode_btree_initialize(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0x83,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree_record",
+	 inode_btree_record );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_btree_record->inode_number",
+	 inode_btree_record->inode_number,
+	 (uint32_t) 0x80 );
+
+	result = libfsxfs_inode_btree_record_free(
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0x13f,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_btree_record",
+	 inode_btree_record );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_btree_record->inode_number",
+	 inode_btree_record->inode_number,
+	 (uint32_t) 0x100 );
+
+	result = libfsxfs_inode_btree_record_free(
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0x20,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0xc0,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          NULL,
+	          3,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0x83,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          3,
+	          NULL,
+	          48,
+	          0x83,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_btree_get_inode_from_leaf_node(
+	          inode_btree,
+	          4,
+	          fsxfs_test_inode_btree_leaf_records_data1,
+	          48,
+	          0x83,
+	          &inode_btree_record,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_btree_free(
+	          &inode_btree,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_btree",
+	 inode_btree );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_btree_record != NULL )
+	{
+		libfsxfs_inode_btree_record_free(
+		 &inode_btree_record,
+		 NULL );
+	}
+	if( inode_btree != NULL )
+	{
+		libfsxfs_inode_btree_free(
+		 &inode_btree,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -297,6 +927,30 @@ int main(
 	 "libfsxfs_inode_btree_free",
 	 fsxfs_test_inode_btree_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_set_number_of_allocation_groups",
+	 fsxfs_test_inode_btree_set_number_of_allocation_groups );
+
+	/* TODO: add tests for libfsxfs_inode_btree_read_inode_information */
+
+	/* TODO: add tests for libfsxfs_inode_btree_get_stored_inode_information */
+
+	/* TODO: add tests for libfsxfs_inode_btree_get_inode_information */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_get_sub_node_from_branch_node",
+	 fsxfs_test_inode_btree_get_sub_node_from_branch_node );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_btree_get_inode_from_leaf_node",
+	 fsxfs_test_inode_btree_get_inode_from_leaf_node );
+
+	/* TODO: add tests for libfsxfs_inode_btree_read_block */
+
+	/* TODO: add tests for libfsxfs_inode_btree_get_inode_from_node */
+
+	/* TODO: add tests for libfsxfs_inode_btree_get_inode_by_number */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1144 @@
+/*
+ * Library inode_scanner type test program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_unused.h"
+
+#include "../libfsxfs/libfsxfs_definitions.h"
+#include "../libfsxfs/libfsxfs_inode.h"
+#include "../libfsxfs/libfsxfs_inode_scanner.h"
+#include "../libfsxfs/libfsxfs_io_handle.h"
+
+/* Inline attributes data that contains the security.selinux extended attribute
+ */
+uint8_t fsxfs_test_inode_scanner_attributes_data1[ 51 ] = {
+	0x00, 0x33, 0x01, 0x00, 0x07, 0x25, 0x04, 0x73, 0x65, 0x6c, 0x69, 0x6e, 0x75, 0x78, 0x75, 0x6e,
+	0x63, 0x6f, 0x6e, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x5f, 0x75, 0x3a, 0x6f, 0x62, 0x6a, 0x65, 0x63,
+	0x74, 0x5f, 0x72, 0x3a, 0x75, 0x6e, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x65, 0x64, 0x5f, 0x74, 0x3a,
+	0x73, 0x30, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Creates an inode that contains inline extended attributes
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_inode_scanner_create_inode(
+     libfsxfs_inode_t **inode,
+     libcerror_error_t **error )
+{
+	static char *function = "fsxfs_test_inode_scanner_create_inode";
+
+	if( libfsxfs_inode_initialize(
+	     inode,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		return( -1 );
+	}
+	/* The inline attributes data is stored after the version 3 inode core
+	 */
+	if( memory_copy(
+	     &( ( *inode )->data[ 176 ] ),
+	     fsxfs_test_inode_scanner_attributes_data1,
+	     51 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy attributes data.",
+		 function );
+
+		libfsxfs_inode_free(
+		 inode,
+		 NULL );
+
+		return( -1 );
+	}
+	( *inode )->attributes_fork_type   = LIBFSXFS_FORK_TYPE_INLINE_DATA;
+	( *inode )->inline_attributes_data = &( ( *inode )->data[ 176 ] );
+	( *inode )->attributes_fork_size   = 51;
+
+	return( 1 );
+}
+
+/* Tests the libfsxfs_inode_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_io_handle_t *io_handle         = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->inode_size = 256;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_scanner = (libfsxfs_inode_scanner_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_scanner = NULL;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          NULL,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->inode_size = 0;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* Tests the libfsxfs_inode_scanner_close function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_close(
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_get_next_inode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_next_inode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t inode_number    = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_next_inode(
+	          NULL,
+	          &inode_number,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_get_file_mode function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_file_mode(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t file_mode       = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_file_mode(
+	          NULL,
+	          &file_mode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size64_t size            = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_size(
+	          NULL,
+	          &size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_get_modification_time function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_modification_time(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int64_t posix_time       = 0;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_modification_time(
+	          NULL,
+	          &posix_time,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+/* Tests the libfsxfs_inode_scanner_get_number_of_extended_attributes function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_number_of_extended_attributes(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsxfs_inode_t *inode                 = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_io_handle_t *io_handle         = NULL;
+	int number_of_extended_attributes       = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->inode_size = 256;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the inode scanner has no current inode
+	 */
+	result = libfsxfs_inode_scanner_get_number_of_extended_attributes(
+	          inode_scanner,
+	          &number_of_extended_attributes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fsxfs_test_inode_scanner_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_internal_inode_scanner_set_inode(
+	          (libfsxfs_internal_inode_scanner_t *) inode_scanner,
+	          128,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_scanner_get_number_of_extended_attributes(
+	          inode_scanner,
+	          &number_of_extended_attributes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extended_attributes",
+	 number_of_extended_attributes,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_number_of_extended_attributes(
+	          NULL,
+	          &number_of_extended_attributes,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_get_number_of_extended_attributes(
+	          inode_scanner,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_scanner_close(
+	          &inode_scanner,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_inode_scanner_get_extended_attribute_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_inode_scanner_get_extended_attribute_by_index(
+     void )
+{
+	uint8_t value_data[ 64 ];
+
+	libcerror_error_t *error                          = NULL;
+	libfsxfs_extended_attribute_t *extended_attribute = NULL;
+	libfsxfs_inode_t *inode                           = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner           = NULL;
+	libfsxfs_io_handle_t *io_handle                   = NULL;
+	size_t utf8_string_size                           = 0;
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->inode_size = 256;
+
+	result = libfsxfs_inode_scanner_initialize(
+	          &inode_scanner,
+	          io_handle,
+	          NULL,
+	          (libfsxfs_file_system_t *) 0x12345678UL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_inode_scanner_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_internal_inode_scanner_set_inode(
+	          (libfsxfs_internal_inode_scanner_t *) inode_scanner,
+	          128,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          inode_scanner,
+	          0,
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "extended_attribute",
+	 extended_attribute );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the extended attribute remains usable after the inode scanner
+	 * replaced the inode and extended attributes it was retrieved from
+	 */
+	result = fsxfs_test_inode_scanner_create_inode(
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_internal_inode_scanner_set_inode(
+	          (libfsxfs_internal_inode_scanner_t *) inode_scanner,
+	          129,
+	          &inode,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_extended_attribute_get_utf8_name_size(
+	          extended_attribute,
+	          &utf8_string_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfsxfs_extended_attribute_read_buffer(
+	              extended_attribute,
+	              value_data,
+	              64,
+	              &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 37 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( fsxfs_test_inode_scanner_attributes_data1[ 14 ] ),
+	          37 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsxfs_extended_attribute_free(
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "extended_attribute",
+	 extended_attribute );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          NULL,
+	          0,
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          inode_scanner,
+	          -1,
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          inode_scanner,
+	          1,
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          inode_scanner,
+	          0,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extended_attribute = (libfsxfs_extended_attribute_t *) 0x12345678UL;
+
+	result = libfsxfs_inode_scanner_get_extended_attribute_by_index(
+	          inode_scanner,
+	          0,
+	          &extended_attribute,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	extended_attribute = NULL;
+
+	/* Clean up
+	 */
+	result = libfsxfs_inode_scanner_close(
+	          &inode_scanner,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( extended_attribute != NULL )
+	{
+		libfsxfs_extended_attribute_free(
+		 &extended_attribute,
+		 NULL );
+	}
+	if( inode != NULL )
+	{
+		libfsxfs_inode_free(
+		 &inode,
+		 NULL );
+	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSXFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSXFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSXFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_initialize",
+	 fsxfs_test_inode_scanner_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_close",
+	 fsxfs_test_inode_scanner_close );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_next_inode",
+	 fsxfs_test_inode_scanner_get_next_inode );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_file_mode",
+	 fsxfs_test_inode_scanner_get_file_mode );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_size",
+	 fsxfs_test_inode_scanner_get_size );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_modification_time",
+	 fsxfs_test_inode_scanner_get_modification_time );
+
+#if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_number_of_extended_attributes",
+	 fsxfs_test_inode_scanner_get_number_of_extended_attributes );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_inode_scanner_get_extended_attribute_by_index",
+	 fsxfs_test_inode_scanner_get_extended_attribute_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
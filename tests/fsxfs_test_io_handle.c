@@ -398,6 +398,210 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_io_handle_get_mapped_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_io_handle_get_mapped_data(
+     void )
+{
+	uint8_t mapped_data[ 64 ];
+
+	libcerror_error_t *error        = NULL;
+	libfsxfs_io_handle_t *io_handle = NULL;
+	const uint8_t *data             = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->mapped_data      = mapped_data;
+	io_handle->mapped_data_size = 64;
+
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          16,
+	          48,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data == &( mapped_data[ 16 ] ) ),
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          16,
+	          49,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          64,
+	          1,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_io_handle_get_mapped_data(
+	          NULL,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          -1,
+	          16,
+	          &data,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_io_handle_get_mapped_data(
+	          io_handle,
+	          0,
+	          16,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	io_handle->mapped_data      = NULL;
+	io_handle->mapped_data_size = 0;
+
+	result = libfsxfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsxfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +633,10 @@ int main(
 	 "libfsxfs_io_handle_clear",
 	 fsxfs_test_io_handle_clear );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_io_handle_get_mapped_data",
+	 fsxfs_test_io_handle_get_mapped_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -1238,21 +1238,1157 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsxfs_volume_set_read_allocation_groups_on_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_read_allocation_groups_on_open(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_read_allocation_groups_on_open(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_read_allocation_groups_on_open(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_read_allocation_groups_on_open(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_verify_metadata_checksums function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_verify_metadata_checksums(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_verify_metadata_checksums(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_verify_metadata_checksums(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_verify_metadata_checksums(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_maximum_number_of_file_io_handles function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_maximum_number_of_file_io_handles(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_file_io_handles(
+	          volume,
+	          4,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_maximum_number_of_file_io_handles(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_maximum_number_of_file_io_handles(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_set_maximum_number_of_file_io_handles(
+	          volume,
+	          -1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_set_use_memory_mapping function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_set_use_memory_mapping(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	libfsxfs_volume_t *volume = NULL;
+	int result                = 0;
+
+	/* Initialize test
+	 */
+	result = libfsxfs_volume_initialize(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          volume,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          volume,
+	          0,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_set_use_memory_mapping(
+	          NULL,
+	          1,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsxfs_volume_free(
+	          &volume,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsxfs_volume_get_format_version function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_get_format_version(
+int fsxfs_test_volume_get_format_version(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t format_version   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_format_version(
+	          volume,
+	          &format_version,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_format_version(
+	          NULL,
+	          &format_version,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_format_version(
+		  volume,
+		  NULL,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_features_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_features_flags(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error                     = NULL;
+	uint32_t compatible_features_flags           = 0;
+	uint32_t incompatible_features_flags         = 0;
+	uint32_t journal_incompatible_features_flags = 0;
+	uint32_t read_only_compatible_features_flags = 0;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_features_flags(
+	          volume,
+	          &compatible_features_flags,
+	          &read_only_compatible_features_flags,
+	          &incompatible_features_flags,
+	          &journal_incompatible_features_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_features_flags(
+	          NULL,
+	          &compatible_features_flags,
+	          &read_only_compatible_features_flags,
+	          &incompatible_features_flags,
+	          &journal_incompatible_features_flags,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_features_flags(
+		  volume,
+		  NULL,
+	          &read_only_compatible_features_flags,
+	          &incompatible_features_flags,
+	          &journal_incompatible_features_flags,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_features_flags(
+		  volume,
+	          &compatible_features_flags,
+		  NULL,
+	          &incompatible_features_flags,
+	          &journal_incompatible_features_flags,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_features_flags(
+		  volume,
+	          &compatible_features_flags,
+	          &read_only_compatible_features_flags,
+		  NULL,
+	          &journal_incompatible_features_flags,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_features_flags(
+		  volume,
+	          &compatible_features_flags,
+	          &read_only_compatible_features_flags,
+	          &incompatible_features_flags,
+		  NULL,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_utf8_label_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_utf8_label_size(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_label_size   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_utf8_label_size(
+	          volume,
+	          &utf8_label_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_utf8_label_size(
+	          NULL,
+	          &utf8_label_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf8_label_size(
+		  volume,
+		  NULL,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_utf8_label function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_utf8_label(
+     libfsxfs_volume_t *volume )
+{
+	uint8_t utf8_label[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_utf8_label(
+	          volume,
+	          utf8_label,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_utf8_label(
+	          NULL,
+	          utf8_label,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf8_label(
+		  volume,
+		  NULL,
+		  512,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf8_label(
+		  volume,
+		  utf8_label,
+		  0,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf8_label(
+		  volume,
+		  utf8_label,
+		  (size_t) SSIZE_MAX + 1,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_utf16_label_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_utf16_label_size(
      libfsxfs_volume_t *volume )
 {
 	libcerror_error_t *error = NULL;
-	uint8_t format_version   = 0;
+	size_t utf16_label_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_utf16_label_size(
+	          volume,
+	          &utf16_label_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_utf16_label_size(
+	          NULL,
+	          &utf16_label_size,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf16_label_size(
+		  volume,
+		  NULL,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_utf16_label function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_utf16_label(
+     libfsxfs_volume_t *volume )
+{
+	uint16_t utf16_label[ 512 ];
+
+	libcerror_error_t *error = NULL;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_volume_get_format_version(
+	result = libfsxfs_volume_get_utf16_label(
+	          volume,
+	          utf16_label,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_utf16_label(
+	          NULL,
+	          utf16_label,
+	          512,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf16_label(
+		  volume,
+		  NULL,
+		  512,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf16_label(
+		  volume,
+		  utf16_label,
+		  0,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_utf16_label(
+		  volume,
+		  utf16_label,
+		  (size_t) SSIZE_MAX + 1,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_number_of_file_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_number_of_file_entries(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	uint32_t number_of_file_entries = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_number_of_file_entries(
+	          volume,
+	          &number_of_file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_get_number_of_file_entries(
+	          NULL,
+	          &number_of_file_entries,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_number_of_file_entries(
+	          volume,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsxfs_volume_get_root_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int fsxfs_test_volume_get_root_directory(
+     libfsxfs_volume_t *volume )
+{
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *root_directory = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsxfs_volume_get_root_directory(
 	          volume,
-	          &format_version,
+	          &root_directory,
 	          &error );
 
 	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1264,11 +2400,28 @@ int fsxfs_test_volume_get_format_version(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "root_directory",
+	 root_directory );
+
+	result = libfsxfs_file_entry_free(
+		  &root_directory,
+		  &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_volume_get_format_version(
+	result = libfsxfs_volume_get_root_directory(
 	          NULL,
-	          &format_version,
+	          &root_directory,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1276,6 +2429,10 @@ int fsxfs_test_volume_get_format_version(
 	 result,
 	 -1 );
 
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1283,7 +2440,7 @@ int fsxfs_test_volume_get_format_version(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_format_version(
+	result = libfsxfs_volume_get_root_directory(
 		  volume,
 		  NULL,
 		  &error );
@@ -1293,6 +2450,10 @@ int fsxfs_test_volume_get_format_version(
 	 result,
 	 -1 );
 
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "root_directory",
+	 root_directory );
+
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1311,113 +2472,101 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_get_features_flags function
+/* Tests the libfsxfs_volume_open_inode_scanner function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_get_features_flags(
+int fsxfs_test_volume_open_inode_scanner(
      libfsxfs_volume_t *volume )
 {
-	libcerror_error_t *error                     = NULL;
-	uint32_t compatible_features_flags           = 0;
-	uint32_t incompatible_features_flags         = 0;
-	uint32_t journal_incompatible_features_flags = 0;
-	uint32_t read_only_compatible_features_flags = 0;
-	int result                                   = 0;
+	libcerror_error_t *error                = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	uint64_t inode_number                   = 0;
+	uint16_t file_mode                      = 0;
+	int result                              = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_volume_get_features_flags(
+	result = libfsxfs_volume_open_inode_scanner(
 	          volume,
-	          &compatible_features_flags,
-	          &read_only_compatible_features_flags,
-	          &incompatible_features_flags,
-	          &journal_incompatible_features_flags,
+	          &inode_scanner,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_scanner",
+	 inode_scanner );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* The file system contains at least the root directory inode
 	 */
-	result = libfsxfs_volume_get_features_flags(
-	          NULL,
-	          &compatible_features_flags,
-	          &read_only_compatible_features_flags,
-	          &incompatible_features_flags,
-	          &journal_incompatible_features_flags,
+	result = libfsxfs_inode_scanner_get_next_inode(
+	          inode_scanner,
+	          &inode_number,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_volume_get_features_flags(
-		  volume,
-		  NULL,
-	          &read_only_compatible_features_flags,
-	          &incompatible_features_flags,
-	          &journal_incompatible_features_flags,
-		  &error );
+	result = libfsxfs_inode_scanner_get_file_mode(
+	          inode_scanner,
+	          &file_mode,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_volume_get_features_flags(
-		  volume,
-	          &compatible_features_flags,
-		  NULL,
-	          &incompatible_features_flags,
-	          &journal_incompatible_features_flags,
-		  &error );
+	result = libfsxfs_inode_scanner_close(
+	          &inode_scanner,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_volume_get_features_flags(
-		  volume,
-	          &compatible_features_flags,
-	          &read_only_compatible_features_flags,
-		  NULL,
-	          &journal_incompatible_features_flags,
-		  &error );
+	/* Test error cases
+	 */
+	result = libfsxfs_volume_open_inode_scanner(
+	          NULL,
+	          &inode_scanner,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "inode_scanner",
+	 inode_scanner );
+
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1425,13 +2574,10 @@ int fsxfs_test_volume_get_features_flags(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_features_flags(
-		  volume,
-	          &compatible_features_flags,
-	          &read_only_compatible_features_flags,
-	          &incompatible_features_flags,
-		  NULL,
-		  &error );
+	result = libfsxfs_volume_open_inode_scanner(
+	          volume,
+	          NULL,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1453,116 +2599,145 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_get_utf8_label_size function
+/* Callback function for the libfsxfs_volume_scan_inodes test
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_scan_inodes_callback(
+     libfsxfs_inode_scanner_t *inode_scanner,
+     uint64_t inode_number,
+     void *callback_arguments )
+{
+	uint64_t *last_inode_number = NULL;
+	uint16_t file_mode          = 0;
+
+	last_inode_number = (uint64_t *) callback_arguments;
+
+	if( libfsxfs_inode_scanner_get_file_mode(
+	     inode_scanner,
+	     &file_mode,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	/* The inodes are expected to be delivered in inode number order
+	 */
+	if( ( last_inode_number[ 1 ] != 0 )
+	 && ( inode_number <= last_inode_number[ 0 ] ) )
+	{
+		return( -1 );
+	}
+	last_inode_number[ 0 ]  = inode_number;
+	last_inode_number[ 1 ] += 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsxfs_volume_scan_inodes function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_get_utf8_label_size(
+int fsxfs_test_volume_scan_inodes(
      libfsxfs_volume_t *volume )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf8_label_size   = 0;
-	int result               = 0;
+	uint64_t callback_values[ 2 ]           = { 0, 0 };
+	libcerror_error_t *error                = NULL;
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	uint64_t inode_number                   = 0;
+	uint64_t number_of_inodes               = 0;
+	int result                              = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libfsxfs_volume_get_utf8_label_size(
+	result = libfsxfs_volume_open_inode_scanner(
 	          volume,
-	          &utf8_label_size,
+	          &inode_scanner,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsxfs_volume_get_utf8_label_size(
-	          NULL,
-	          &utf8_label_size,
-	          &error );
+	do
+	{
+		result = libfsxfs_inode_scanner_get_next_inode(
+		          inode_scanner,
+		          &inode_number,
+		          &error );
 
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		if( result == 1 )
+		{
+			number_of_inodes++;
+		}
+	}
+	while( result == 1 );
 
-	result = libfsxfs_volume_get_utf8_label_size(
-		  volume,
-		  NULL,
-		  &error );
+	result = libfsxfs_inode_scanner_close(
+	          &inode_scanner,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libfsxfs_volume_get_utf8_label function
- * Returns 1 if successful or 0 if not
- */
-int fsxfs_test_volume_get_utf8_label(
-     libfsxfs_volume_t *volume )
-{
-	uint8_t utf8_label[ 512 ];
-
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
 	/* Test regular cases
 	 */
-	result = libfsxfs_volume_get_utf8_label(
+	result = libfsxfs_volume_scan_inodes(
 	          volume,
-	          utf8_label,
-	          512,
+	          2,
+	          LIBFSXFS_INODE_SCAN_FLAG_ORDERED,
+	          &fsxfs_test_volume_scan_inodes_callback,
+	          (void *) callback_values,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_inodes",
+	 callback_values[ 1 ],
+	 number_of_inodes );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_volume_get_utf8_label(
+	result = libfsxfs_volume_scan_inodes(
 	          NULL,
-	          utf8_label,
-	          512,
+	          2,
+	          0,
+	          &fsxfs_test_volume_scan_inodes_callback,
+	          (void *) callback_values,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1577,29 +2752,13 @@ int fsxfs_test_volume_get_utf8_label(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_utf8_label(
-		  volume,
-		  NULL,
-		  512,
-		  &error );
-
-	FSXFS_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_volume_get_utf8_label(
-		  volume,
-		  utf8_label,
-		  0,
-		  &error );
+	result = libfsxfs_volume_scan_inodes(
+	          volume,
+	          0,
+	          0,
+	          &fsxfs_test_volume_scan_inodes_callback,
+	          (void *) callback_values,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1613,11 +2772,13 @@ int fsxfs_test_volume_get_utf8_label(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_utf8_label(
-		  volume,
-		  utf8_label,
-		  (size_t) SSIZE_MAX + 1,
-		  &error );
+	result = libfsxfs_volume_scan_inodes(
+	          volume,
+	          2,
+	          0,
+	          NULL,
+	          (void *) callback_values,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1639,116 +2800,137 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_get_utf16_label_size function
+/* Tests the libfsxfs_volume_get_inodes_cache_statistics function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_get_utf16_label_size(
+int fsxfs_test_volume_get_inodes_cache_statistics(
      libfsxfs_volume_t *volume )
 {
-	libcerror_error_t *error = NULL;
-	size_t utf16_label_size  = 0;
-	int result               = 0;
+	libcerror_error_t *error              = NULL;
+	libfsxfs_file_entry_t *root_directory = NULL;
+	uint64_t number_of_evictions          = 0;
+	uint64_t number_of_hits               = 0;
+	uint64_t number_of_misses             = 0;
+	uint64_t previous_number_of_hits      = 0;
+	uint64_t previous_number_of_misses    = 0;
+	int result                            = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_volume_get_utf16_label_size(
+	result = libfsxfs_volume_get_root_directory(
 	          volume,
-	          &utf16_label_size,
+	          &root_directory,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfsxfs_volume_get_utf16_label_size(
-	          NULL,
-	          &utf16_label_size,
+	result = libfsxfs_file_entry_free(
+	          &root_directory,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfsxfs_volume_get_utf16_label_size(
-		  volume,
-		  NULL,
-		  &error );
+	result = libfsxfs_volume_get_inodes_cache_statistics(
+	          volume,
+	          &previous_number_of_hits,
+	          &previous_number_of_misses,
+	          &number_of_evictions,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* The root directory inode should now be retrieved from the inodes cache
+	 */
+	result = libfsxfs_volume_get_root_directory(
+	          volume,
+	          &root_directory,
+	          &error );
 
-	return( 1 );
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfsxfs_volume_get_utf16_label function
- * Returns 1 if successful or 0 if not
- */
-int fsxfs_test_volume_get_utf16_label(
-     libfsxfs_volume_t *volume )
-{
-	uint16_t utf16_label[ 512 ];
+	result = libfsxfs_file_entry_free(
+	          &root_directory,
+	          &error );
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Test regular cases
-	 */
-	result = libfsxfs_volume_get_utf16_label(
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_inodes_cache_statistics(
 	          volume,
-	          utf16_label,
-	          512,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "previous_number_of_hits",
+	 previous_number_of_hits,
+	 number_of_hits );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 previous_number_of_misses );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_volume_get_utf16_label(
+	result = libfsxfs_volume_get_inodes_cache_statistics(
 	          NULL,
-	          utf16_label,
-	          512,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1763,11 +2945,12 @@ int fsxfs_test_volume_get_utf16_label(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_utf16_label(
-		  volume,
-		  NULL,
-		  512,
-		  &error );
+	result = libfsxfs_volume_get_inodes_cache_statistics(
+	          volume,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1781,11 +2964,12 @@ int fsxfs_test_volume_get_utf16_label(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_utf16_label(
-		  volume,
-		  utf16_label,
-		  0,
-		  &error );
+	result = libfsxfs_volume_get_inodes_cache_statistics(
+	          volume,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1799,11 +2983,12 @@ int fsxfs_test_volume_get_utf16_label(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_utf16_label(
-		  volume,
-		  utf16_label,
-		  (size_t) SSIZE_MAX + 1,
-		  &error );
+	result = libfsxfs_volume_get_inodes_cache_statistics(
+	          volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1825,42 +3010,119 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libfsxfs_volume_get_root_directory function
+/* Tests the libfsxfs_volume_get_directory_entries_cache_statistics function
  * Returns 1 if successful or 0 if not
  */
-int fsxfs_test_volume_get_root_directory(
+int fsxfs_test_volume_get_directory_entries_cache_statistics(
      libfsxfs_volume_t *volume )
 {
-	libcerror_error_t *error              = NULL;
-	libfsxfs_file_entry_t *root_directory = 0;
-	int result                            = 0;
+	libcerror_error_t *error           = NULL;
+	libfsxfs_file_entry_t *file_entry  = NULL;
+	uint64_t number_of_hits            = 0;
+	uint64_t number_of_misses          = 0;
+	uint64_t previous_number_of_hits   = 0;
+	uint64_t previous_number_of_misses = 0;
+	int result                         = 0;
 
 	/* Test regular cases
 	 */
-	result = libfsxfs_volume_get_root_directory(
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
 	          volume,
-	          &root_directory,
+	          &previous_number_of_hits,
+	          &previous_number_of_misses,
 	          &error );
 
-	FSXFS_TEST_ASSERT_NOT_EQUAL_INT(
+	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FSXFS_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	FSXFS_TEST_ASSERT_IS_NOT_NULL(
-	 "root_directory",
-	 root_directory );
+	/* The first lookup of a non-existing name should be a miss that
+	 * stores a negative entry in the directory entries cache
+	 */
+	result = libfsxfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          (uint8_t *) "/fsxfs_test_nonexistent",
+	          23,
+	          &file_entry,
+	          &error );
 
-	result = libfsxfs_file_entry_free(
-		  &root_directory,
-		  &error );
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
+	          volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "previous_number_of_misses",
+	 previous_number_of_misses,
+	 number_of_misses );
+
+	previous_number_of_hits   = number_of_hits;
+	previous_number_of_misses = number_of_misses;
+
+	/* The second lookup should be a hit on the negative entry
+	 */
+	result = libfsxfs_volume_get_file_entry_by_utf8_path(
+	          volume,
+	          (uint8_t *) "/fsxfs_test_nonexistent",
+	          23,
+	          &file_entry,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "file_entry",
+	 file_entry );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
+	          volume,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1871,11 +3133,22 @@ int fsxfs_test_volume_get_root_directory(
 	 "error",
 	 error );
 
+	FSXFS_TEST_ASSERT_LESS_THAN_UINT64(
+	 "previous_number_of_hits",
+	 previous_number_of_hits,
+	 number_of_hits );
+
+	FSXFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 previous_number_of_misses );
+
 	/* Test error cases
 	 */
-	result = libfsxfs_volume_get_root_directory(
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
 	          NULL,
-	          &root_directory,
+	          &number_of_hits,
+	          &number_of_misses,
 	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
@@ -1883,10 +3156,6 @@ int fsxfs_test_volume_get_root_directory(
 	 result,
 	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
-
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1894,19 +3163,34 @@ int fsxfs_test_volume_get_root_directory(
 	libcerror_error_free(
 	 &error );
 
-	result = libfsxfs_volume_get_root_directory(
-		  volume,
-		  NULL,
-		  &error );
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
+	          volume,
+	          NULL,
+	          &number_of_misses,
+	          &error );
 
 	FSXFS_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	FSXFS_TEST_ASSERT_IS_NULL(
-	 "root_directory",
-	 root_directory );
+	FSXFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsxfs_volume_get_directory_entries_cache_statistics(
+	          volume,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	FSXFS_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
@@ -1923,6 +3207,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_entry != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2010,6 +3300,22 @@ int main(
 	 "libfsxfs_volume_free",
 	 fsxfs_test_volume_free );
 
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_read_allocation_groups_on_open",
+	 fsxfs_test_volume_set_read_allocation_groups_on_open );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_verify_metadata_checksums",
+	 fsxfs_test_volume_set_verify_metadata_checksums );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_maximum_number_of_file_io_handles",
+	 fsxfs_test_volume_set_maximum_number_of_file_io_handles );
+
+	FSXFS_TEST_RUN(
+	 "libfsxfs_volume_set_use_memory_mapping",
+	 fsxfs_test_volume_set_use_memory_mapping );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2179,6 +3485,11 @@ int main(
 		 fsxfs_test_volume_get_utf16_label,
 		 volume );
 
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_number_of_file_entries",
+		 fsxfs_test_volume_get_number_of_file_entries,
+		 volume );
+
 #if defined( __GNUC__ ) && !defined( LIBFSXFS_DLL_IMPORT )
 
 		/* TODO: add tests for libfsxfs_internal_volume_get_root_directory */
@@ -2214,6 +3525,26 @@ int main(
 
 		/* TODO: add tests for libfsxfs_volume_get_file_entry_by_utf16_path */
 
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_open_inode_scanner",
+		 fsxfs_test_volume_open_inode_scanner,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_scan_inodes",
+		 fsxfs_test_volume_scan_inodes,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_inodes_cache_statistics",
+		 fsxfs_test_volume_get_inodes_cache_statistics,
+		 volume );
+
+		FSXFS_TEST_RUN_WITH_ARGS(
+		 "libfsxfs_volume_get_directory_entries_cache_statistics",
+		 fsxfs_test_volume_get_directory_entries_cache_statistics,
+		 volume );
+
 		/* Clean up
 		 */
 		result = fsxfs_test_volume_close_source(
@@ -0,0 +1,818 @@
+/*
+ * Library volume concurrent lookup throughput benchmark program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libcthreads.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_unused.h"
+
+/* The maximum number of inodes that are looked up
+ */
+#define FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_INODES	1024
+
+/* The number of times the inodes are looked up per thread
+ */
+#define FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_NUMBER_OF_ITERATIONS		8
+
+/* The maximum number of threads
+ */
+#define FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS	8
+
+typedef struct fsxfs_test_volume_lookup_benchmark_worker fsxfs_test_volume_lookup_benchmark_worker_t;
+
+struct fsxfs_test_volume_lookup_benchmark_worker
+{
+	/* The volume
+	 */
+	libfsxfs_volume_t *volume;
+
+	/* The inode numbers
+	 */
+	uint64_t *inode_numbers;
+
+	/* The number of inode numbers
+	 */
+	int number_of_inode_numbers;
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The number of lookups
+	 */
+	int number_of_lookups;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Retrieves the numbers of the used inodes of the source volume
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_lookup_benchmark_get_inode_numbers(
+     const system_character_t *source,
+     uint64_t *inode_numbers,
+     int maximum_number_of_inode_numbers,
+     int *number_of_inode_numbers,
+     libcerror_error_t **error )
+{
+	libfsxfs_inode_scanner_t *inode_scanner = NULL;
+	libfsxfs_volume_t *volume               = NULL;
+	static char *function                   = "fsxfs_test_volume_lookup_benchmark_get_inode_numbers";
+	uint64_t inode_number                   = 0;
+	int result                              = 0;
+
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_inode_numbers = 0;
+
+	if( libfsxfs_volume_initialize(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsxfs_volume_open_wide(
+	     volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsxfs_volume_open(
+	     volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_open_inode_scanner(
+	     volume,
+	     &inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	while( *number_of_inode_numbers < maximum_number_of_inode_numbers )
+	{
+		result = libfsxfs_inode_scanner_get_next_inode(
+		          inode_scanner,
+		          &inode_number,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next inode.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		inode_numbers[ *number_of_inode_numbers ] = inode_number;
+
+		*number_of_inode_numbers += 1;
+	}
+	if( libfsxfs_inode_scanner_close(
+	     &inode_scanner,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to close inode scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_close(
+	     volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_free(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( inode_scanner != NULL )
+	{
+		libfsxfs_inode_scanner_close(
+		 &inode_scanner,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Looks up the inodes of a worker
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_lookup_benchmark_worker_run(
+     fsxfs_test_volume_lookup_benchmark_worker_t *worker )
+{
+	libfsxfs_file_entry_t *file_entry = NULL;
+	int inode_number_index            = 0;
+	int iteration                     = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->number_of_lookups = 0;
+	worker->result            = 1;
+
+	for( iteration = 0;
+	     iteration < worker->number_of_iterations;
+	     iteration++ )
+	{
+		if( libfsxfs_volume_get_root_directory(
+		     worker->volume,
+		     &file_entry,
+		     NULL ) == -1 )
+		{
+			worker->result = -1;
+
+			break;
+		}
+		if( file_entry != NULL )
+		{
+			if( libfsxfs_file_entry_free(
+			     &file_entry,
+			     NULL ) != 1 )
+			{
+				worker->result = -1;
+
+				break;
+			}
+		}
+		worker->number_of_lookups += 1;
+
+		for( inode_number_index = 0;
+		     inode_number_index < worker->number_of_inode_numbers;
+		     inode_number_index++ )
+		{
+			if( libfsxfs_volume_get_file_entry_by_inode(
+			     worker->volume,
+			     worker->inode_numbers[ inode_number_index ],
+			     &file_entry,
+			     NULL ) != 1 )
+			{
+				worker->result = -1;
+
+				break;
+			}
+			if( libfsxfs_file_entry_free(
+			     &file_entry,
+			     NULL ) != 1 )
+			{
+				worker->result = -1;
+
+				break;
+			}
+			worker->number_of_lookups += 1;
+		}
+		if( worker->result != 1 )
+		{
+			break;
+		}
+	}
+	return( worker->result );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* The lookup benchmark thread callback function
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_lookup_benchmark_thread_callback(
+     void *arguments )
+{
+	return( fsxfs_test_volume_lookup_benchmark_worker_run(
+	         (fsxfs_test_volume_lookup_benchmark_worker_t *) arguments ) );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Opens the source volume and looks up the inodes with a number of threads
+ * concurrently. Every thread looks up the inodes in a different order starting
+ * with a cold inodes cache.
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_lookup_benchmark_run(
+     const system_character_t *source,
+     uint64_t *inode_numbers,
+     int number_of_inode_numbers,
+     int number_of_threads,
+     int number_of_iterations,
+     uint64_t *elapsed_time,
+     uint64_t *number_of_lookups,
+     libcerror_error_t **error )
+{
+	fsxfs_test_volume_lookup_benchmark_worker_t workers[ FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	libfsxfs_volume_t *volume = NULL;
+	uint64_t *thread_numbers  = NULL;
+	static char *function     = "fsxfs_test_volume_lookup_benchmark_run";
+	uint64_t end_time         = 0;
+	uint64_t start_time       = 0;
+	int inode_number_index    = 0;
+	int result                = 1;
+	int thread_index          = 0;
+
+	if( inode_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_inode_numbers < 0 )
+	 || ( number_of_inode_numbers > FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_INODES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of inode numbers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lookups.",
+		 function );
+
+		return( -1 );
+	}
+	*elapsed_time      = 0;
+	*number_of_lookups = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Every thread uses a rotated copy of the inode numbers so that the threads
+	 * do not look up the same inode at the same time
+	 */
+	if( number_of_inode_numbers > 0 )
+	{
+		thread_numbers = (uint64_t *) memory_allocate(
+		                               sizeof( uint64_t ) * number_of_inode_numbers * number_of_threads );
+
+		if( thread_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create thread inode numbers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		for( inode_number_index = 0;
+		     inode_number_index < number_of_inode_numbers;
+		     inode_number_index++ )
+		{
+			thread_numbers[ ( thread_index * number_of_inode_numbers ) + inode_number_index ] =
+				inode_numbers[ ( inode_number_index + ( ( thread_index * number_of_inode_numbers ) / number_of_threads ) ) % number_of_inode_numbers ];
+		}
+	}
+	if( libfsxfs_volume_initialize(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libfsxfs_volume_open_wide(
+	     volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libfsxfs_volume_open(
+	     volume,
+	     source,
+	     LIBFSXFS_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		workers[ thread_index ].volume                  = volume;
+		workers[ thread_index ].inode_numbers           = NULL;
+		workers[ thread_index ].number_of_inode_numbers = number_of_inode_numbers;
+		workers[ thread_index ].number_of_iterations    = number_of_iterations;
+		workers[ thread_index ].number_of_lookups       = 0;
+		workers[ thread_index ].result                  = 0;
+
+		if( thread_numbers != NULL )
+		{
+			workers[ thread_index ].inode_numbers = &( thread_numbers[ thread_index * number_of_inode_numbers ] );
+		}
+	}
+	if( fsxfs_test_get_time_in_microseconds(
+	     &start_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start time.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &fsxfs_test_volume_lookup_benchmark_thread_callback,
+		     (void *) &( workers[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+#else
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		fsxfs_test_volume_lookup_benchmark_worker_run(
+		 &( workers[ thread_index ] ) );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( fsxfs_test_get_time_in_microseconds(
+	     &end_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end time.",
+		 function );
+
+		goto on_error;
+	}
+	*elapsed_time = end_time - start_time;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( workers[ thread_index ].result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to look up inodes in thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+		*number_of_lookups += (uint64_t) workers[ thread_index ].number_of_lookups;
+	}
+	if( libfsxfs_volume_close(
+	     volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsxfs_volume_free(
+	     &volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( thread_numbers != NULL )
+	{
+		memory_free(
+		 thread_numbers );
+	}
+	return( result );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+#endif
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( thread_numbers != NULL )
+	{
+		memory_free(
+		 thread_numbers );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	uint64_t inode_numbers[ FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_INODES ];
+
+	libcerror_error_t *error      = NULL;
+	system_character_t *source    = NULL;
+	uint64_t elapsed_time         = 0;
+	uint64_t lookups_per_second   = 0;
+	uint64_t number_of_lookups    = 0;
+	system_integer_t option       = 0;
+	int maximum_number_of_threads = 1;
+	int number_of_inode_numbers   = 0;
+	int number_of_threads         = 0;
+	int result                    = 0;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( source == NULL )
+	{
+		return( EXIT_SUCCESS );
+	}
+	result = fsxfs_test_volume_lookup_benchmark_get_inode_numbers(
+	          source,
+	          inode_numbers,
+	          FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_INODES,
+	          &number_of_inode_numbers,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	maximum_number_of_threads = FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_MAXIMUM_NUMBER_OF_THREADS;
+#endif
+
+	fprintf(
+	 stdout,
+	 "Lookup throughput of %d inodes over %d iterations per thread:\n",
+	 number_of_inode_numbers,
+	 FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_NUMBER_OF_ITERATIONS );
+
+	for( number_of_threads = 1;
+	     number_of_threads <= maximum_number_of_threads;
+	     number_of_threads *= 2 )
+	{
+		result = fsxfs_test_volume_lookup_benchmark_run(
+		          source,
+		          inode_numbers,
+		          number_of_inode_numbers,
+		          number_of_threads,
+		          FSXFS_TEST_VOLUME_LOOKUP_BENCHMARK_NUMBER_OF_ITERATIONS,
+		          &elapsed_time,
+		          &number_of_lookups,
+		          &error );
+
+		FSXFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSXFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		lookups_per_second = 0;
+
+		if( elapsed_time > 0 )
+		{
+			lookups_per_second = ( number_of_lookups * 1000000 ) / elapsed_time;
+		}
+		fprintf(
+		 stdout,
+		 "\tthreads: %d\t: lookups: %" PRIu64 ", elapsed: %" PRIu64 " us, lookups per second: %" PRIu64 "\n",
+		 number_of_threads,
+		 number_of_lookups,
+		 elapsed_time,
+		 lookups_per_second );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,373 @@
+/*
+ * Library volume open latency benchmark program
+ *
+ * Copyright (C) 2020-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsxfs_test_functions.h"
+#include "fsxfs_test_getopt.h"
+#include "fsxfs_test_libcerror.h"
+#include "fsxfs_test_libfsxfs.h"
+#include "fsxfs_test_macros.h"
+#include "fsxfs_test_unused.h"
+
+/* The number of times the volume is opened per mode
+ */
+#define FSXFS_TEST_VOLUME_OPEN_BENCHMARK_NUMBER_OF_ITERATIONS	16
+
+/* Opens the source volume a number of times and measures the latency
+ * of the open and of the first root directory lookup
+ * Returns 1 if successful or -1 on error
+ */
+int fsxfs_test_volume_open_benchmark_run(
+     const system_character_t *source,
+     uint8_t read_allocation_groups_on_open,
+     int number_of_iterations,
+     uint64_t *open_time,
+     uint64_t *lookup_time,
+     libcerror_error_t **error )
+{
+	libfsxfs_file_entry_t *root_directory = NULL;
+	libfsxfs_volume_t *volume             = NULL;
+	static char *function                 = "fsxfs_test_volume_open_benchmark_run";
+	uint64_t end_time                     = 0;
+	uint64_t open_end_time                = 0;
+	uint64_t start_time                   = 0;
+	int iteration                         = 0;
+
+	if( open_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid open time.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup time.",
+		 function );
+
+		return( -1 );
+	}
+	*open_time   = 0;
+	*lookup_time = 0;
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( libfsxfs_volume_initialize(
+		     &volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create volume.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_volume_set_read_allocation_groups_on_open(
+		     volume,
+		     read_allocation_groups_on_open,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read allocation groups on open.",
+			 function );
+
+			goto on_error;
+		}
+		if( fsxfs_test_get_time_in_microseconds(
+		     &start_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve start time.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libfsxfs_volume_open_wide(
+		     volume,
+		     source,
+		     LIBFSXFS_OPEN_READ,
+		     error ) != 1 )
+#else
+		if( libfsxfs_volume_open(
+		     volume,
+		     source,
+		     LIBFSXFS_OPEN_READ,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open volume.",
+			 function );
+
+			goto on_error;
+		}
+		if( fsxfs_test_get_time_in_microseconds(
+		     &open_end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve open end time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_volume_get_root_directory(
+		     volume,
+		     &root_directory,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( fsxfs_test_get_time_in_microseconds(
+		     &end_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve end time.",
+			 function );
+
+			goto on_error;
+		}
+		*open_time   += open_end_time - start_time;
+		*lookup_time += end_time - open_end_time;
+
+		if( root_directory != NULL )
+		{
+			if( libfsxfs_file_entry_free(
+			     &root_directory,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free root directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libfsxfs_volume_close(
+		     volume,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close volume.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsxfs_volume_free(
+		     &volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_iterations > 0 )
+	{
+		*open_time   /= number_of_iterations;
+		*lookup_time /= number_of_iterations;
+	}
+	return( 1 );
+
+on_error:
+	if( root_directory != NULL )
+	{
+		libfsxfs_file_entry_free(
+		 &root_directory,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfsxfs_volume_free(
+		 &volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	system_character_t *source = NULL;
+	uint64_t eager_lookup_time = 0;
+	uint64_t eager_open_time   = 0;
+	uint64_t lazy_lookup_time  = 0;
+	uint64_t lazy_open_time    = 0;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = fsxfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( source == NULL )
+	{
+		return( EXIT_SUCCESS );
+	}
+	result = fsxfs_test_volume_open_benchmark_run(
+	          source,
+	          0,
+	          FSXFS_TEST_VOLUME_OPEN_BENCHMARK_NUMBER_OF_ITERATIONS,
+	          &lazy_open_time,
+	          &lazy_lookup_time,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fsxfs_test_volume_open_benchmark_run(
+	          source,
+	          1,
+	          FSXFS_TEST_VOLUME_OPEN_BENCHMARK_NUMBER_OF_ITERATIONS,
+	          &eager_open_time,
+	          &eager_lookup_time,
+	          &error );
+
+	FSXFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSXFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fprintf(
+	 stdout,
+	 "Average volume open latency over %d iterations:\n",
+	 FSXFS_TEST_VOLUME_OPEN_BENCHMARK_NUMBER_OF_ITERATIONS );
+
+	fprintf(
+	 stdout,
+	 "\tread allocation groups on demand\t: open: %" PRIu64 " us, root directory: %" PRIu64 " us\n",
+	 lazy_open_time,
+	 lazy_lookup_time );
+
+	fprintf(
+	 stdout,
+	 "\tread allocation groups on open\t\t: open: %" PRIu64 " us, root directory: %" PRIu64 " us\n",
+	 eager_open_time,
+	 eager_lookup_time );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
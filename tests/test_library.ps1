@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "attribute_values attributes attributes_leaf_block_header attributes_table attributes_table_header block_directory block_directory_footer block_directory_header btree_block btree_header buffer_data_handle directory_entry directory_table directory_table_header error extent file_entry file_system_block file_system_block_header inode_btree inode_btree_record inode_information io_handle notify superblock"
-$LibraryTestsWithInput = "support volume"
+$LibraryTests = "attribute_values attributes attributes_leaf_block_header attributes_table attributes_table_header block_directory block_directory_footer block_directory_header btree_block btree_header buffer_data_handle cache_shard checksum directory directory_entry directory_iterator directory_table directory_table_header error extent extent_array extent_btree file_entry file_system file_system_block file_system_block_header inode inode_btree inode_btree_record inode_information inode_scanner io_handle name_hash notify superblock"
+$LibraryTestsWithInput = "support volume volume_lookup_benchmark volume_open_benchmark"
 $OptionSets = "offset" -split " "
 
 . .\test_functions.ps1